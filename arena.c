@@ -0,0 +1,37 @@
+#include "dcc.h"
+
+// Objects are carved out of large zeroed chunks, so they are packed
+// contiguously and cost no per-object malloc header. Nothing is freed
+// individually; arena_free () releases everything at once.
+
+#define CHUNK_SIZE (64 * 1024)
+
+struct ArenaChunk {
+  ArenaChunk *next;
+};
+
+// Returns zeroed memory aligned to 8 bytes.
+void *arena_alloc (Arena *arena, size_t size) {
+  size = (size + 7) & ~7;
+
+  if (arena->ptr + size > arena->end) {
+    size_t cap = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+    ArenaChunk *chunk = calloc (1, sizeof (ArenaChunk) + cap);
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    arena->ptr = (char *) (chunk + 1);
+    arena->end = arena->ptr + cap;
+  }
+
+  void *p = arena->ptr;
+  arena->ptr += size;
+  return p;
+}
+
+void arena_free (Arena *arena) {
+  for (ArenaChunk *c = arena->chunks, *next; c; c = next) {
+    next = c->next;
+    free (c);
+  }
+  *arena = (Arena) {};
+}
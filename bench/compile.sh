@@ -0,0 +1,127 @@
+#!/bin/bash
+#
+# Compiler throughput benchmark.
+#
+# Generates deterministic synthetic sources with bench/gen, compiles
+# each one with "dcc -fstats=json" and reports per-phase times,
+# lines/sec, tokens/sec and peak memory.
+#
+# Absolute numbers depend on the machine, so results are compared with
+# a reference compiler built from the git revision $BENCH_BASE (HEAD by
+# default) and measured in the same run. Set BENCH_BASE=none to only
+# report the numbers.
+
+cd "$(dirname "$0")/.."
+
+DCC=./dcc
+GEN=bench/gen
+OUT=bench/out
+BASE_DIR=$OUT/base
+BENCH_BASE=${BENCH_BASE:-HEAD}
+RUNS=5
+
+# A workload is slower than the reference if its throughput drops
+# below, or its peak memory grows above, these percentages.
+MIN_SPEED=70
+MAX_MEMORY=125
+
+WORKLOADS=(
+  "functions 5000"
+  "expr 500"
+  "nested 2000"
+  "locals 3000"
+  "init 100000"
+  "strings 500"
+  "mixed 2000"
+)
+
+mkdir -p $OUT
+
+# Builds the reference compiler from a clean checkout of $BENCH_BASE.
+base_dcc=
+if [ "$BENCH_BASE" != none ]; then
+  rev=$(git rev-parse --verify -q "$BENCH_BASE^{commit}") || {
+    echo "unknown revision: $BENCH_BASE"; exit 1; }
+  if [ "$(cat $BASE_DIR/REVISION 2>/dev/null)" != $rev ]; then
+    rm -rf $BASE_DIR
+    mkdir -p $BASE_DIR
+    git archive $rev | tar -x -C $BASE_DIR || exit 1
+    make -s -C $BASE_DIR dcc > /dev/null 2>&1 || { echo "cannot build $BENCH_BASE"; exit 1; }
+    echo $rev > $BASE_DIR/REVISION
+  fi
+  base_dcc=$BASE_DIR/dcc
+fi
+
+# Extracts a numeric field from a -fstats=json report.
+field () {
+  echo "$1" | sed -n "s/.*\"$2\":\([0-9.]*\).*/\1/p"
+}
+
+# Compiles $src with the given compiler $RUNS times and sets $best to
+# the report of the fastest run and $best_total to its time.
+measure () {
+  best=
+  best_total=
+  for i in $(seq $RUNS); do
+    report=$($1 -fstats=json -o /dev/null $src 2>&1) || { echo "$report"; exit 1; }
+    total=$(for p in read_file tokenize parse layout codegen; do field "$report" $p; done |
+            awk '{ s += $1 } END { print s }')
+    if [ -z "$best" ] || awk -v a="$total" -v b="$best_total" 'BEGIN { exit !(a < b) }'; then
+      best=$report
+      best_total=$total
+    fi
+  done
+}
+
+printf "%-10s %8s %8s %8s %8s %8s %8s %10s %10s %9s %6s\n" \
+  workload lines read tokenize parse layout codegen lines/s tokens/s peak_KiB vs_ref
+
+status=0
+
+for w in "${WORKLOADS[@]}"; do
+  set -- $w
+  name=$1
+  src=$OUT/$name.c
+  $GEN $1 $2 > $src || exit 1
+  lines=$(wc -l < $src)
+
+  # Keep the fastest of several runs.
+  measure $DCC
+  tokens=$(field "$best" tokens)
+  peak=$(field "$best" peak_rss_kib)
+  lps=$(awk -v n=$lines -v t=$best_total 'BEGIN { printf "%d", n / (t / 1000) }')
+  tps=$(awk -v n=$tokens -v t=$best_total 'BEGIN { printf "%d", n / (t / 1000) }')
+
+  # Speed relative to the reference compiler. Token counts may differ
+  # between the two, so compare tokens/s rather than times.
+  vs=-
+  if [ -n "$base_dcc" ]; then
+    report=$best
+    measure $base_dcc
+    base_tokens=$(field "$best" tokens)
+    base_peak=$(field "$best" peak_rss_kib)
+    base_tps=$(awk -v n=$base_tokens -v t=$best_total 'BEGIN { printf "%d", n / (t / 1000) }')
+    vs=$(awk -v a=$tps -v b=$base_tps 'BEGIN { printf "%.2f", a / b }')
+    best=$report
+  fi
+
+  printf "%-10s %8d %8.2f %8.2f %8.2f %8.2f %8.2f %10d %10d %9d %6s\n" \
+    $name $lines $(field "$best" read_file) $(field "$best" tokenize) \
+    $(field "$best" parse) $(field "$best" layout) $(field "$best" codegen) \
+    $lps $tps $peak $vs
+
+  if [ -n "$base_dcc" ]; then
+    if [ $((tps * 100)) -lt $((base_tps * MIN_SPEED)) ]; then
+      echo "  REGRESSION: $name: $tps tokens/s, reference $base_tps tokens/s"
+      status=1
+    fi
+    if [ $((peak * 100)) -gt $((base_peak * MAX_MEMORY)) ]; then
+      echo "  REGRESSION: $name: peak $peak KiB, reference $base_peak KiB"
+      status=1
+    fi
+  fi
+done
+
+echo "(times in ms, best of $RUNS runs; vs_ref is tokens/s relative to ${BENCH_BASE})"
+
+exit $status
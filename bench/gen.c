@@ -0,0 +1,172 @@
+// Deterministic generator of synthetic C sources for the compiler
+// throughput benchmark. Everything it emits stays within the subset
+// of C that dcc accepts.
+//
+// usage: gen <workload> <size>
+//
+//   functions  <size> small functions calling each other
+//   expr       expressions nested <size> levels deep
+//   nested     40 functions with statements nested <size> levels deep
+//   locals     a function with <size> local variables
+//   init       global arrays with <size> initializers in total
+//   strings    <size> string literals close to the length limit
+//   mixed      a bit of everything, scaled by <size>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned long seed = 12345;
+
+// Linear congruential generator, so that output is
+// identical on every machine and every run.
+static int rnd (int n) {
+  seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+  return (seed >> 33) % n;
+}
+
+static void gen_functions (int n) {
+  for (int i = 0; i < n; i++) {
+    printf ("int f%d (int a, int b, int c) {\n", i);
+    printf ("  int x = a + b * %d;\n", rnd (100));
+    printf ("  int y = c - %d;\n", rnd (100));
+    printf ("  int i;\n");
+    printf ("  for (i = 0; i < %d; i = i + 1) {\n", rnd (10) + 1);
+    printf ("    if (x < y) x = x + i; else y = y - i;\n");
+    printf ("  }\n");
+    printf ("  while (x > %d) x = x / 2;\n", rnd (1000));
+    if (i > 0)
+      printf ("  return f%d (x, y, a) + x * y;\n", rnd (i));
+    else
+      printf ("  return x * y;\n");
+    printf ("}\n\n");
+  }
+
+  printf ("int main () {\n  return f%d (1, 2, 3);\n}\n", n - 1);
+}
+
+static void gen_expr_rec (int depth) {
+  if (depth == 0) {
+    printf ("%s", (char *[]) { "a", "b", "c" } [rnd (3)]);
+    return;
+  }
+
+  static char *ops [] = { "+", "-", "*", "/", "<", "==" };
+  printf ("(");
+  gen_expr_rec (depth - 1);
+  printf (" %s %d)", ops [rnd (6)], rnd (100) + 1);
+}
+
+static void gen_expr (int depth) {
+  for (int i = 0; i < 20; i++) {
+    printf ("int e%d (int a, int b, int c) {\n  return ", i);
+    gen_expr_rec (depth);
+    printf (";\n}\n\n");
+  }
+
+  printf ("int main () {\n  return e0 (1, 2, 3);\n}\n");
+}
+
+static void gen_nested (int depth) {
+  static char *stmts [] = { "if (x < %d) ", "if (x > %d) x = x - 1; else ", "{ x = x + %d; " };
+
+  for (int f = 0; f < 40; f++) {
+    int nblocks = 0;
+    printf ("int n%d (int x) {\n  ", f);
+    for (int i = 0; i < depth; i++) {
+      int k = rnd (3);
+      printf (stmts [k], rnd (100));
+      if (k == 2)
+        nblocks++;
+    }
+    printf ("x = x + 1;");
+    for (int i = 0; i < nblocks; i++)
+      printf (" }");
+    printf ("\n  return x;\n}\n\n");
+  }
+
+  printf ("int main () {\n  return n0 (0);\n}\n");
+}
+
+static void gen_locals (int n) {
+  printf ("int main () {\n");
+  for (int i = 0; i < n; i++)
+    printf ("  int v%d = %d;\n", i, rnd (1000));
+  printf ("  int sum = 0;\n");
+  for (int i = 0; i < n; i++)
+    printf ("  sum = sum + v%d * v%d;\n", i, rnd (n));
+  printf ("  return sum;\n}\n");
+}
+
+static void gen_init (int n) {
+  int per_array = 1000;
+  int narrays = (n + per_array - 1) / per_array;
+
+  for (int i = 0; i < narrays; i++) {
+    printf ("int g%d [%d] = {", i, per_array);
+    for (int j = 0; j < per_array; j++)
+      printf ("%s%d", j ? ", " : "", rnd (100000));
+    printf ("};\n");
+  }
+
+  printf ("\nint main () {\n  return g0 [0];\n}\n");
+}
+
+static void gen_strings (int n) {
+  static char chars [] = "abcdefghijklmnopqrstuvwxyz0123456789 ";
+
+  printf ("int main () {\n  char *s;\n");
+  for (int i = 0; i < n; i++) {
+    printf ("  s = \"");
+    for (int j = 0; j < 1000; j++)
+      putchar (chars [rnd (sizeof (chars) - 1)]);
+    printf ("\";\n");
+  }
+  printf ("  return s [0];\n}\n");
+}
+
+static void gen_mixed (int n) {
+  for (int i = 0; i < n; i++) {
+    printf ("int m%d (int a, int b, int c) {\n", i);
+    printf ("  int buf [16];\n");
+    printf ("  char *msg = \"function m%d\";\n", i);
+    printf ("  int k;\n");
+    printf ("  for (k = 0; k < 16; k = k + 1)\n");
+    printf ("    buf [k] = k * %d + a;\n", rnd (50));
+    printf ("  return ");
+    gen_expr_rec (8);
+    printf (" + buf [%d] + msg [0];\n}\n\n", rnd (16));
+  }
+
+  printf ("int main () {\n  return m0 (1, 2, 3);\n}\n");
+}
+
+int main (int argc, char **argv) {
+  if (argc != 3) {
+    fprintf (stderr, "usage: %s <workload> <size>\n", argv [0]);
+    return 1;
+  }
+
+  int size = atoi (argv [2]);
+  char *kind = argv [1];
+
+  if (!strcmp (kind, "functions"))
+    gen_functions (size);
+  else if (!strcmp (kind, "expr"))
+    gen_expr (size);
+  else if (!strcmp (kind, "nested"))
+    gen_nested (size);
+  else if (!strcmp (kind, "locals"))
+    gen_locals (size);
+  else if (!strcmp (kind, "init"))
+    gen_init (size);
+  else if (!strcmp (kind, "strings"))
+    gen_strings (size);
+  else if (!strcmp (kind, "mixed"))
+    gen_mixed (size);
+  else {
+    fprintf (stderr, "unknown workload: %s\n", kind);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,38 @@
+// Pointer chasing: a chain of dependent loads through a random
+// cyclic permutation. Without structs or casts the links are
+// array indices, which gives the same load-to-load dependency.
+
+int next [1048576];
+
+int main () {
+  int n = 1048576;
+  int x1 = 1;
+  int x2 = 7;
+  int i;
+
+  for (i = 0; i < n; i = i + 1)
+    next [i] = i;
+
+  // Sattolo's algorithm yields a single cycle through all elements.
+  for (i = n - 1; i > 0; i = i - 1) {
+    x1 = x1 * 75 + 74;
+    x1 = x1 - x1 / 65537 * 65537;
+    x2 = x2 * 75 + 74;
+    x2 = x2 - x2 / 65537 * 65537;
+    int r = x1 * 16 + (x2 - x2 / 16 * 16);
+    r = r - r / i * i;
+    int t = next [i];
+    next [i] = next [r];
+    next [r] = t;
+  }
+
+  int p = 0;
+  int steps = 0;
+  for (i = 0; i < 5000000; i = i + 1) {
+    p = next [p];
+    steps = steps + p;
+    steps = steps - steps / 1000000 * 1000000;
+  }
+  printf ("%d %d\n", p, steps);
+  return 0;
+}
@@ -0,0 +1,12 @@
+// Recursive Fibonacci: call overhead and stack traffic.
+
+int fib (int n) {
+  if (n < 2)
+    return n;
+  return fib (n - 1) + fib (n - 2);
+}
+
+int main () {
+  printf ("%d\n", fib (35));
+  return 0;
+}
@@ -0,0 +1,35 @@
+// Matrix multiply: nested loops and two-dimensional indexing.
+
+int a [300][300];
+int b [300][300];
+int c [300][300];
+
+int main () {
+  int n = 300;
+  int i;
+  int j;
+  int k;
+
+  for (i = 0; i < n; i = i + 1) {
+    for (j = 0; j < n; j = j + 1) {
+      a [i][j] = (i + j) - (i + j) / 10 * 10;
+      b [i][j] = (i * j) - (i * j) / 7 * 7;
+    }
+  }
+
+  for (i = 0; i < n; i = i + 1) {
+    for (j = 0; j < n; j = j + 1) {
+      int sum = 0;
+      for (k = 0; k < n; k = k + 1)
+        sum = sum + a [i][k] * b [k][j];
+      c [i][j] = sum;
+    }
+  }
+
+  int check = 0;
+  for (i = 0; i < n; i = i + 1)
+    for (j = 0; j < n; j = j + 1)
+      check = check + c [i][j];
+  printf ("%d\n", check);
+  return 0;
+}
@@ -0,0 +1,30 @@
+// Sieve of Eratosthenes: byte loads and stores in a large array.
+
+char flags [2000000];
+
+int sieve (int n) {
+  int count = 0;
+  int i;
+  int j;
+
+  for (i = 2; i <= n; i = i + 1)
+    flags [i] = 1;
+
+  for (i = 2; i <= n; i = i + 1) {
+    if (flags [i]) {
+      count = count + 1;
+      for (j = i + i; j <= n; j = j + i)
+        flags [j] = 0;
+    }
+  }
+  return count;
+}
+
+int main () {
+  int total = 0;
+  int r;
+  for (r = 0; r < 5; r = r + 1)
+    total = total + sieve (1999999);
+  printf ("%d\n", total);
+  return 0;
+}
@@ -0,0 +1,34 @@
+// Bubble sort: compare-and-swap loops with unpredictable branches.
+
+int data [8000];
+
+int main () {
+  int n = 8000;
+  int x = 1;
+  int i;
+  int j;
+
+  // Pseudo-random input from a small linear congruential generator
+  for (i = 0; i < n; i = i + 1) {
+    x = x * 1103 + 12345;
+    x = x - x / 32768 * 32768;
+    data [i] = x;
+  }
+
+  for (i = 0; i < n; i = i + 1) {
+    for (j = 0; j < n - 1 - i; j = j + 1) {
+      if (data [j + 1] < data [j]) {
+        int t = data [j];
+        data [j] = data [j + 1];
+        data [j + 1] = t;
+      }
+    }
+  }
+
+  int sorted = 1;
+  for (i = 0; i < n - 1; i = i + 1)
+    if (data [i + 1] < data [i])
+      sorted = 0;
+  printf ("%d %d %d %d\n", sorted, data [0], data [n / 2], data [n - 1]);
+  return 0;
+}
@@ -0,0 +1,55 @@
+// String scanning: byte-wise loops over a long text.
+// (111 is 'o'; dcc has no character literals yet.)
+
+char text [200000];
+
+int count_char (char *s, int c) {
+  int n = 0;
+  while (*s) {
+    if (*s == c)
+      n = n + 1;
+    s = s + 1;
+  }
+  return n;
+}
+
+int count_word (char *s, char *w) {
+  int n = 0;
+  while (*s) {
+    char *p = s;
+    char *q = w;
+    while (*q == *p) {
+      p = p + 1;
+      q = q + 1;
+      if (*q == 0)
+        n = n + 1;
+    }
+    s = s + 1;
+  }
+  return n;
+}
+
+int main () {
+  char *src = "the quick brown fox jumps over the lazy dog and then the dog sleeps ";
+  int len = 0;
+  while (src [len])
+    len = len + 1;
+
+  int i = 0;
+  int k = 0;
+  while (i + len < 199999) {
+    for (k = 0; k < len; k = k + 1)
+      text [i + k] = src [k];
+    i = i + len;
+  }
+  text [i] = 0;
+
+  int total = 0;
+  int r;
+  for (r = 0; r < 200; r = r + 1) {
+    total = total + count_char (text, 111);
+    total = total + count_word (text, "the");
+  }
+  printf ("%d\n", total);
+  return 0;
+}
@@ -0,0 +1,86 @@
+#!/bin/bash
+#
+# Runtime benchmark for code generated by dcc.
+#
+# Each program in bench/run is compiled with dcc, dcc -O, gcc -O0 and
+# gcc -O2. The harness checks that all four print the same result,
+# times them (best of several runs) and reports dcc's time relative to
+# gcc together with the .text size of each object.
+
+cd "$(dirname "$0")/.."
+
+DCC=./dcc
+OUT=bench/out/run
+RUNS=3
+
+# The programs are written in the subset of C that dcc accepts, which
+# has no prototypes, so they call printf undeclared. gcc gets its
+# declaration this way.
+GCC_FLAGS="-w -include stdio.h"
+
+mkdir -p $OUT
+
+# Prints the best wall time of a program in milliseconds.
+time_ms () {
+  best=
+  for i in $(seq $RUNS); do
+    start=$(date +%s%N)
+    "$1" > /dev/null
+    end=$(date +%s%N)
+    t=$(( (end - start) / 1000000 ))
+    if [ -z "$best" ] || [ $t -lt $best ]; then
+      best=$t
+    fi
+  done
+  echo $best
+}
+
+text_size () {
+  size -A "$1" | awk '$1 ~ /^\.text/ { s += $2 } END { print s + 0 }'
+}
+
+ratio () {
+  awk -v a=$1 -v b=$2 'BEGIN { if (b > 0) printf "%.2f", a / b; else print "-" }'
+}
+
+printf "%-8s %9s %9s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n" \
+  bench dcc_ms dccO_ms O0_ms O2_ms dcc/O0 dccO/O0 dccO/O2 \
+  dcc_text dccO_text O0_text O2_text
+
+status=0
+for src in bench/run/*.c; do
+  name=$(basename $src .c)
+  exe=$OUT/$name
+
+  $DCC $src > $exe.s || exit 1
+  gcc -c -o $exe.dcc.o $exe.s || exit 1
+  gcc -static -o $exe.dcc $exe.dcc.o || exit 1
+  $DCC -O $src > $exe.dccO.s || exit 1
+  gcc -c -o $exe.dccO.o $exe.dccO.s || exit 1
+  gcc -static -o $exe.dccO $exe.dccO.o || exit 1
+  gcc $GCC_FLAGS -O0 -c -o $exe.O0.o $src && gcc -static -o $exe.O0 $exe.O0.o || exit 1
+  gcc $GCC_FLAGS -O2 -c -o $exe.O2.o $src && gcc -static -o $exe.O2 $exe.O2.o || exit 1
+
+  expected=$($exe.O0)
+  for v in dcc dccO O2; do
+    actual=$($exe.$v)
+    if [ "$actual" != "$expected" ]; then
+      echo "$name: $v printed '$actual', expected '$expected'"
+      status=1
+    fi
+  done
+
+  t_dcc=$(time_ms $exe.dcc)
+  t_dccO=$(time_ms $exe.dccO)
+  t_O0=$(time_ms $exe.O0)
+  t_O2=$(time_ms $exe.O2)
+
+  printf "%-8s %9d %9d %9d %9d %9s %9s %9s %9d %9d %9d %9d\n" \
+    $name $t_dcc $t_dccO $t_O0 $t_O2 \
+    $(ratio $t_dcc $t_O0) $(ratio $t_dccO $t_O0) $(ratio $t_dccO $t_O2) \
+    $(text_size $exe.dcc.o) $(text_size $exe.dccO.o) \
+    $(text_size $exe.O0.o) $(text_size $exe.O2.o)
+done
+
+echo "(times in ms, best of $RUNS runs; sizes in bytes)"
+exit $status
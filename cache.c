@@ -0,0 +1,256 @@
+#include "dcc.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+// Content-addressed compilation cache.
+//
+// The output of a compilation is fully determined by the compiler
+// version, the flags and the input bytes, so the cache stores the
+// generated assembly under a hash of those three. Entries live in
+// $DCC_CACHE_DIR as "<hash>.s"; their mtime is refreshed on every hit
+// and the least recently used ones are evicted once the directory
+// grows beyond $DCC_CACHE_SIZE bytes. The total size is kept in the
+// stats file, so that the directory is only scanned when eviction
+// is actually due.
+
+#define DEFAULT_CACHE_SIZE (256 * 1024 * 1024)
+
+static char *cache_dir;
+static atomic_int hits;
+static atomic_int misses;
+
+bool cache_init (void) {
+  cache_dir = getenv ("DCC_CACHE_DIR");
+  if (!cache_dir || !*cache_dir) {
+    cache_dir = NULL;
+    return false;
+  }
+
+  if (mkdir (cache_dir, 0777) && errno != EEXIST)
+    error ("cannot create cache directory %s: %s", cache_dir, strerror (errno));
+  return true;
+}
+
+// 64-bit FNV-1a. Two lanes with different offset bases give a
+// 128-bit key, which makes accidental collisions a non-issue.
+void fnv1a (unsigned long *h, char *buf, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    *h ^= (unsigned char) buf [i];
+    *h *= 0x100000001b3UL;
+  }
+}
+
+char *cache_key (char *input, char *flags) {
+  unsigned long h [2] = { 0xcbf29ce484222325UL, 0x84222325cbf29ce4UL };
+  char *parts [] = { DCC_VERSION, flags, input };
+
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < sizeof (parts) / sizeof (*parts); j++)
+      fnv1a (&h [i], parts [j], strlen (parts [j]) + 1);
+
+  char *key = calloc (1, 33);
+  sprintf (key, "%016lx%016lx", h [0], h [1]);
+  return key;
+}
+
+static char *entry_path (char *name) {
+  char *path = calloc (1, strlen (cache_dir) + strlen (name) + 2);
+  sprintf (path, "%s/%s", cache_dir, name);
+  return path;
+}
+
+// Copies a cached entry to out. Returns false on a miss.
+bool cache_lookup (char *key, FILE *out) {
+  char name [40];
+  sprintf (name, "%s.s", key);
+  char *path = entry_path (name);
+
+  FILE *fp = fopen (path, "r");
+  if (!fp) {
+    free (path);
+    misses++;
+    return false;
+  }
+
+  char buf [65536];
+  size_t n;
+  while ((n = fread (buf, 1, sizeof (buf), fp)) > 0)
+    fwrite (buf, 1, n, out);
+  fclose (fp);
+
+  // Mark the entry as recently used.
+  utime (path, NULL);
+  free (path);
+  hits++;
+  return true;
+}
+
+typedef struct {
+  char *path;
+  time_t mtime;
+  off_t size;
+} CacheEntry;
+
+static int cmp_mtime (const void *a, const void *b) {
+  const CacheEntry *x = a, *y = b;
+  return (x->mtime > y->mtime) - (x->mtime < y->mtime);
+}
+
+static long cache_limit (void) {
+  char *env = getenv ("DCC_CACHE_SIZE");
+  return env ? atol (env) : DEFAULT_CACHE_SIZE;
+}
+
+// Removes the least recently used entries until the cache fits in
+// limit bytes again. Returns the size of the remaining entries.
+static long evict (long limit) {
+  DIR *dir = opendir (cache_dir);
+  if (!dir)
+    return 0;
+
+  CacheEntry *ents = NULL;
+  int nents = 0, cap = 0;
+  long total = 0;
+
+  for (struct dirent *de; (de = readdir (dir)); ) {
+    int len = strlen (de->d_name);
+    if (len < 2 || strcmp (de->d_name + len - 2, ".s"))
+      continue;
+
+    char *path = entry_path (de->d_name);
+    struct stat st;
+    if (stat (path, &st)) {
+      free (path);
+      continue;
+    }
+
+    if (nents == cap) {
+      cap = cap ? cap * 2 : 64;
+      ents = realloc (ents, cap * sizeof (CacheEntry));
+    }
+    ents [nents++] = (CacheEntry) { path, st.st_mtime, st.st_size };
+    total += st.st_size;
+  }
+  closedir (dir);
+
+  qsort (ents, nents, sizeof (CacheEntry), cmp_mtime);
+  for (int i = 0; i < nents && total > limit; i++) {
+    if (!unlink (ents [i].path))
+      total -= ents [i].size;
+  }
+
+  for (int i = 0; i < nents; i++)
+    free (ents [i].path);
+  free (ents);
+  return total;
+}
+
+// Hit/miss counters and the total size of the entries are kept in
+// $DCC_CACHE_DIR/stats across runs. The file is locked while it is
+// read and updated. A size of -1 means that it is not known yet.
+typedef struct {
+  long hits;
+  long misses;
+  long size;
+} CacheStats;
+
+static FILE *open_stats (CacheStats *st) {
+  char *path = entry_path ("stats");
+  int fd = open (path, O_RDWR | O_CREAT, 0666);
+  free (path);
+  if (fd < 0)
+    return NULL;
+  flock (fd, LOCK_EX);
+
+  FILE *fp = fdopen (fd, "r+");
+  *st = (CacheStats) { 0, 0, -1 };
+  int n = fscanf (fp, "hits %ld\nmisses %ld\nsize %ld\n", &st->hits, &st->misses, &st->size);
+  if (n < 2)
+    *st = (CacheStats) { 0, 0, -1 };
+  else if (n < 3)
+    st->size = -1;
+  return fp;
+}
+
+static void write_stats (FILE *fp, CacheStats *st) {
+  rewind (fp);
+  ftruncate (fileno (fp), 0);
+  fprintf (fp, "hits %ld\nmisses %ld\nsize %ld\n", st->hits, st->misses, st->size);
+}
+
+void cache_store (char *key, char *buf, size_t len) {
+  // Write to a temporary file and rename it into place, so that
+  // concurrent compilers never observe a partially written entry.
+  // The temporary name is unique, as other threads or processes
+  // may be storing the same key at the same time.
+  char name [64];
+  sprintf (name, "%s.XXXXXX", key);
+  char *tmp = entry_path (name);
+  sprintf (name, "%s.s", key);
+  char *path = entry_path (name);
+
+  bool stored = false;
+  int fd = mkstemp (tmp);
+  if (fd >= 0) {
+    fchmod (fd, 0644);
+    FILE *fp = fdopen (fd, "w");
+    fwrite (buf, 1, len, fp);
+    stored = fclose (fp) == 0 && rename (tmp, path) == 0;
+    if (!stored)
+      unlink (tmp);
+  }
+  free (tmp);
+  free (path);
+
+  if (!stored)
+    return;
+
+  // Replacing an existing entry overestimates the size, which at
+  // worst makes the next eviction scan come a little early.
+  CacheStats st;
+  FILE *fp = open_stats (&st);
+  if (!fp)
+    return;
+
+  long limit = cache_limit ();
+  if (st.size < 0 || st.size + (long) len > limit)
+    st.size = evict (limit);
+  else
+    st.size += len;
+  write_stats (fp, &st);
+  fclose (fp);
+}
+
+void cache_finish (bool print_stats) {
+  if (!cache_dir) {
+    if (print_stats)
+      fprintf (stderr, "dcc: cache disabled (DCC_CACHE_DIR is not set)\n");
+    return;
+  }
+
+  CacheStats st;
+  FILE *fp = open_stats (&st);
+  if (!fp)
+    return;
+
+  st.hits += hits;
+  st.misses += misses;
+  if (hits || misses)
+    write_stats (fp, &st);
+  fclose (fp);
+
+  long total_hits = st.hits, total_misses = st.misses;
+
+  if (print_stats) {
+    long total = total_hits + total_misses;
+    fprintf (stderr, "dcc: cache %s\n", cache_dir);
+    fprintf (stderr, "  this run: %d hits, %d misses\n", (int) hits, (int) misses);
+    fprintf (stderr, "  total:    %ld hits, %ld misses (%.1f%% hit rate)\n",
+             total_hits, total_misses, total ? 100.0 * total_hits / total : 0.0);
+  }
+}
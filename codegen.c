@@ -1,23 +1,131 @@
 #include "dcc.h"
 
 static char *argreg1 [] = { "dil", "sil", "dl", "cl", "r8b", "r9b" };
+static char *argreg4 [] = { "edi", "esi", "edx", "ecx", "r8d", "r9d" };
 static char *argreg8 [] = { "rdi", "rsi", "rdx", "rcx", "r8", "r9" };
 
-static int labelseq = 0;
-static char *funcname;
+static _Thread_local int labelseq;
+static _Thread_local char *funcname;
+static _Thread_local FILE *output_file;
+static _Thread_local int last_line;	// Line of the last .loc directive
+static _Thread_local int last_file;
+
+// Profile-guided layout
+static _Thread_local int nsites;	// Counters allocated in this function
+static _Thread_local long *counts;	// -fprofile-use counts of this function
+static _Thread_local FILE *cold_file;	// Cold blocks, emitted after the epilogue
+static _Thread_local char *cold_buf;
+static _Thread_local size_t cold_len;
+static _Thread_local bool in_cold;
+
+// With -fomit-frame-pointer, leaf functions have no rbp frame and
+// address their locals relative to rsp, which moves with every push
+// and pop of the expression stack.
+static _Thread_local bool frameless;
+static _Thread_local int frame_size;	// Bytes reserved for locals
+static _Thread_local int depth;		// Bytes pushed since the prologue
 
 static void gen (Node *node);
 
+static void println (char *fmt, ...) {
+  // Instructions are indented; labels and directives are not.
+  if (fmt [0] == ' ' && fmt [2] != '.')
+    stats.insns++;
+
+  va_list ap;
+  va_start (ap, fmt);
+  vfprintf (output_file, fmt, ap);
+  va_end (ap);
+}
+
+// With -g, maps the following instructions to tok's source line.
+// Headers are named right before each use, so that a piece of code
+// moved elsewhere still finds its file. Repeating .file is allowed.
+static void emit_loc (Token *tok) {
+  if (!opt_g || (tok->line_no == last_line && tok->file_no == last_file))
+    return;
+  if (tok->file_no != 1)
+    println ("  .file %d \"%s\"\n", tok->file_no, tok->file->name);
+  println ("  .loc %d %d %d\n", tok->file_no, tok->line_no, tok->col);
+  last_line = tok->line_no;
+  last_file = tok->file_no;
+}
+
+// The expression stack. The register is pasted into the format as a
+// literal: formatting a %s on every push and pop costs a sizeable
+// part of the codegen time.
+#define push(reg) (println ("  push " reg "\n"), depth += 8)
+#define pop(reg) (println ("  pop " reg "\n"), depth -= 8)
+
+// In a frameless function, returns the offset from rsp of the stack
+// slot that would be at rbp-offset with a frame.
+static int sp_offset (int offset) {
+  return frame_size + depth - offset;
+}
+
+// Sets a promoted local from src, truncated to the local's type
+// like a store to memory would. src is a register of the same size.
+static void store_reg (Var *var, char *src) {
+  if (var->ty->size == 1)
+    println ("  movsx %s, %s\n", var->reg, src);
+  else if (var->ty->size == 4)
+    println ("  movsxd %s, %s\n", var->reg, src);
+  else
+    println ("  mov %s, %s\n", var->reg, src);
+}
+
+// Allocates n consecutive counters for a branch or call site.
+// Sites are numbered in the order gen () visits them, which the
+// layout decisions below must not change.
+static int new_site (int n) {
+  int site = nsites;
+  nsites += n;
+  return site;
+}
+
+static void emit_count (int site) {
+  if (opt_profile_generate)
+    println ("  inc QWORD PTR [.L.prof.%s+%d]\n", funcname, site * 8);
+}
+
+// A branch is cold if it ran less than a tenth as often as the
+// other side. Code already moved to the cold area is not split again.
+static bool is_cold (long count, long other) {
+  return counts && !in_cold && count * 10 < other;
+}
+
+// Moves the code generated by the following gen () calls to the cold
+// area after the epilogue. Returns the previous output.
+static FILE *begin_cold (void) {
+  if (!cold_file)
+    cold_file = open_memstream (&cold_buf, &cold_len);
+  FILE *out = output_file;
+  output_file = cold_file;
+  in_cold = true;
+  return out;
+}
+
+static void end_cold (FILE *out) {
+  output_file = out;
+  in_cold = false;
+}
+
 // Pushes the given node's address to the stack.
 static void gen_addr (Node *node) {
   switch (node->kind) {
   case ND_VAR: {
     Var *var = node->var;
+    if (var->reg)
+      error_tok (node->tok, "internal error: address of a register");
     if (var->is_local) {
-      printf ("  lea rax, [rbp-%d]\n", node->var->offset);
-      printf ("  push rax\n");
+      if (frameless)
+        println ("  lea rax, [rsp+%d]\n", sp_offset (var->offset));
+      else
+        println ("  lea rax, [rbp-%d]\n", var->offset);
+      push ("rax");
     } else {
-      printf ("  push offset %s\n", var->name);
+      println ("  push offset %s\n", var->name);
+      depth += 8;
     }
     return;
   }
@@ -36,41 +144,335 @@ static void gen_lval (Node *node) {
 }
 
 static void load (Type *ty) {
-  printf ("  pop rax\n");
+  pop ("rax");
   if (ty->size == 1)
-    printf ("  movsx rax, BYTE PTR [rax]\n");
+    println ("  movsx rax, BYTE PTR [rax]\n");
+  else if (ty->size == 4)
+    println ("  movsxd rax, DWORD PTR [rax]\n");
   else
-    printf ("  mov rax, [rax]\n");
-  printf ("  push rax\n");
+    println ("  mov rax, [rax]\n");
+  push ("rax");
 }
 
 static void store (Type *ty) {
-  printf ("  pop rdi\n");
-  printf ("  pop rax\n");
+  pop ("rdi");
+  pop ("rax");
   if (ty->size == 1)
-    printf ("  mov [rax], dil\n");
+    println ("  mov [rax], dil\n");
+  else if (ty->size == 4)
+    println ("  mov [rax], edi\n");
   else
-    printf ("  mov [rax], rdi\n");
-  printf ("  push rdi\n");
+    println ("  mov [rax], rdi\n");
+  push ("rdi");
+}
+
+static void emit_call (char *fn) {
+  // We need to align rsp to a 16 byte boundary before
+  // calling a function because of an ABI requirement.
+  int seq = labelseq++;
+  println ("  mov rax, rsp\n");
+  println ("  and rax, 15\n");
+  println ("  jnz .L.call.%s.%d\n", funcname, seq);
+  println ("  mov rax, 0\n");
+  println ("  call %s\n", fn);
+  println ("  jmp .L.end.%s.%d\n", funcname, seq);
+  println (".L.call.%s.%d:\n", funcname, seq);
+  println ("  sub rsp, 8\n");
+  println ("  mov rax, 0\n");
+  println ("  call %s\n", fn);
+  println ("  add rsp, 8\n");
+  println (".L.end.%s.%d:\n", funcname, seq);
+}
+
+// while and for loops. If the profile shows that the body usually
+// runs more than once per entry, the loop is rotated so that each
+// iteration takes a single conditional branch at the bottom.
+static void gen_loop (Node *node) {
+  int seq = labelseq++;
+  if (node->init)
+    gen (node->init);
+
+  int site = new_site (2);	// Entries, iterations
+  emit_count (site);
+
+  if (counts && node->cond && counts [site + 1] > counts [site]) {
+    // The condition is generated first to keep the site order.
+    char *buf;
+    size_t len;
+    FILE *out = output_file;
+    output_file = open_memstream (&buf, &len);
+    last_line = 0;
+    emit_loc (node->cond->tok);
+    gen (node->cond);
+    fclose (output_file);
+    output_file = out;
+    depth -= 8;	// Pushed where the buffer is emitted
+
+    println ("  jmp .L.cond.%s.%d\n", funcname, seq);
+    println (".L.begin.%s.%d:\n", funcname, seq);
+    last_line = 0;
+    emit_count (site + 1);
+    gen (node->then);
+    if (node->inc) {
+      emit_loc (node->inc->tok);
+      gen (node->inc);
+    }
+    println (".L.cond.%s.%d:\n", funcname, seq);
+    fwrite (buf, 1, len, output_file);
+    free (buf);
+    depth += 8;
+    last_line = 0;
+    pop ("rax");
+    println ("  cmp rax, 0\n");
+    println ("  jne .L.begin.%s.%d\n", funcname, seq);
+    return;
+  }
+
+  println (".L.begin.%s.%d:\n", funcname, seq);
+  last_line = 0;
+  if (node->cond) {
+    emit_loc (node->cond->tok);
+    gen (node->cond);
+    pop ("rax");
+    println ("  cmp rax, 0\n");
+    println ("  je .L.end.%s.%d\n", funcname, seq);
+  }
+  emit_count (site + 1);
+  gen (node->then);
+  if (node->inc) {
+    emit_loc (node->inc->tok);
+    gen (node->inc);
+  }
+  println ("  jmp .L.begin.%s.%d\n", funcname, seq);
+  println (".L.end.%s.%d:\n", funcname, seq);
+}
+
+// With -O, a ?: whose arms are cheap and cannot fault or have side
+// effects evaluates both arms and picks one with cmov, which costs
+// less than a mispredicted branch. An arm may load from memory only
+// what the condition has already loaded.
+#define MAX_SELECT_COST 8
+
+static bool is_pure_binary (Node *node) {
+  switch (node->kind) {
+  case ND_ADD:
+  case ND_PTR_ADD:
+  case ND_SUB:
+  case ND_PTR_SUB:
+  case ND_MUL:
+  case ND_EQ:
+  case ND_NE:
+  case ND_LT:
+  case ND_LE:
+    return true;
+  }
+  return false;
+}
+
+static bool same_expr (Node *a, Node *b) {
+  if (a->kind != b->kind || a->ty != b->ty)
+    return false;
+  if (a->kind == ND_NUM)
+    return a->val == b->val;
+  if (a->kind == ND_VAR)
+    return a->var == b->var;
+  if (a->kind == ND_DEREF)
+    return same_expr (a->lhs, b->lhs);
+  return is_pure_binary (a) && same_expr (a->lhs, b->lhs) && same_expr (a->rhs, b->rhs);
+}
+
+// Returns true if expr contains node. Only looks into the kinds of
+// nodes an arm may consist of.
+static bool occurs (Node *node, Node *expr) {
+  if (same_expr (node, expr))
+    return true;
+  if (expr->kind == ND_DEREF)
+    return occurs (node, expr->lhs);
+  return is_pure_binary (expr) && (occurs (node, expr->lhs) || occurs (node, expr->rhs));
+}
+
+// Returns the number of nodes in node, or -1 if it is not pure.
+// Loads are allowed only if they occur in loaded, an expression that
+// has been evaluated before.
+static int select_cost (Node *node, Node *loaded) {
+  switch (node->kind) {
+  case ND_NUM:
+  case ND_VAR:
+    return 1;
+  case ND_DEREF: {
+    if (!loaded || !occurs (node, loaded))
+      return -1;
+    int lhs = select_cost (node->lhs, loaded);
+    return lhs < 0 ? -1 : 1 + lhs;
+  }
+  }
+
+  if (!is_pure_binary (node))
+    return -1;
+  int lhs = select_cost (node->lhs, loaded);
+  int rhs = select_cost (node->rhs, loaded);
+  return lhs < 0 || rhs < 0 ? -1 : 1 + lhs + rhs;
+}
+
+static bool is_select (Node *node) {
+  if (!opt_O)
+    return false;
+
+  // Loads in a pure condition have not faulted.
+  Node *loaded = select_cost (node->cond, node->cond) >= 0 ? node->cond : NULL;
+  int then = select_cost (node->then, loaded);
+  int els = select_cost (node->els, loaded);
+  return then >= 0 && els >= 0 && then + els <= MAX_SELECT_COST;
+}
+
+// Condition codes of a comparison and of its negation
+static char *cmp_cc (NodeKind kind, bool negate) {
+  switch (kind) {
+  case ND_EQ:
+    return negate ? "ne" : "e";
+  case ND_NE:
+    return negate ? "e" : "ne";
+  case ND_LT:
+    return negate ? "ge" : "l";
+  case ND_LE:
+    return negate ? "g" : "le";
+  }
+  return NULL;
+}
+
+// Returns true for min and max: a ?: whose arms are the two operands
+// of its comparison, as in "a < b ? a : b". Those are selected with
+// the flags of the comparison itself.
+static bool is_minmax (Node *node) {
+  Node *c = node->cond;
+  if (!opt_O || !cmp_cc (c->kind, false) || select_cost (c, c) < 0)
+    return false;
+  return (same_expr (node->then, c->lhs) && same_expr (node->els, c->rhs)) ||
+         (same_expr (node->then, c->rhs) && same_expr (node->els, c->lhs));
+}
+
+static void gen_cond (Node *node) {
+  if (is_minmax (node)) {
+    Node *c = node->cond;
+    bool swapped = !same_expr (node->then, c->lhs);
+    gen (c->lhs);
+    gen (c->rhs);
+    pop ("rdi");
+    pop ("rax");
+    println ("  cmp rax, rdi\n");
+    println ("  cmov%s rax, rdi\n", cmp_cc (c->kind, !swapped));
+    push ("rax");
+    return;
+  }
+
+  gen (node->cond);
+
+  if (is_select (node)) {
+    gen (node->then);
+    gen (node->els);
+    pop ("rdi");
+    pop ("rax");
+    pop ("rcx");
+    println ("  cmp rcx, 0\n");
+    println ("  cmove rax, rdi\n");
+    push ("rax");
+    return;
+  }
+
+  int seq = labelseq++;
+  pop ("rax");
+  println ("  cmp rax, 0\n");
+  println ("  je .L.else.%s.%d\n", funcname, seq);
+  gen (node->then);
+  println ("  jmp .L.end.%s.%d\n", funcname, seq);
+  depth -= 8;	// The else arm starts without the then arm's value
+  println (".L.else.%s.%d:\n", funcname, seq);
+  gen (node->els);
+  println (".L.end.%s.%d:\n", funcname, seq);
+}
+
+// Returns the assignment of a statement of the form "x = expr;" or
+// "{ x = expr; }", or NULL.
+static Node *single_assign (Node *node) {
+  if (node && node->kind == ND_BLOCK && node->body && !node->body->next)
+    node = node->body;
+  if (!node || node->kind != ND_EXPR_STMT || node->lhs->kind != ND_ASSIGN)
+    return NULL;
+  return node->lhs->lhs->kind == ND_VAR ? node->lhs : NULL;
+}
+
+// If-conversion: with -O, "if (c) x = a; else x = b;" and
+// "if (c) x = a;" are emitted as "x = c ? a : b;" and "x = c ? a : x;",
+// which become a cmov when a and b are cheap. Returns false if node
+// does not have that shape.
+static bool gen_if_select (Node *node) {
+  if (!opt_O || opt_profile_generate)
+    return false;
+
+  Node *then = single_assign (node->then);
+  Node *els = node->els ? single_assign (node->els) : NULL;
+  if (!then || (node->els && (!els || els->lhs->var != then->lhs->var)))
+    return false;
+
+  Node cond = {
+    .kind = ND_COND,
+    .ty = then->ty,
+    .tok = node->tok,
+    .cond = node->cond,
+    .then = then->rhs,
+    .els = els ? els->rhs : then->lhs,
+  };
+  if (!is_minmax (&cond) && !is_select (&cond))
+    return false;
+
+  Node assign = { .kind = ND_ASSIGN, .ty = then->ty, .tok = then->tok, .lhs = then->lhs, .rhs = &cond };
+  gen (&assign);
+  println ("  add rsp, 8\n");
+  depth -= 8;
+  return true;
 }
 
 static void gen (Node *node) {
+  switch (node->kind) {
+  case ND_EXPR_STMT:
+  case ND_RETURN:
+  case ND_IF:
+  case ND_WHILE:
+  case ND_FOR:
+    emit_loc (node->tok);
+    break;
+  }
+
   switch (node->kind) {
   case ND_NULL:
     return;
   case ND_NUM:
-    printf ("  push %d\n", node->val);
+    println ("  push %d\n", node->val);
+    depth += 8;
     return;
   case ND_EXPR_STMT:
     gen (node->lhs);
-    printf ("  add rsp, 8\n"); // pop the stack top
+    println ("  add rsp, 8\n"); // pop the stack top
+    depth -= 8;
     return;
   case ND_VAR:
+    if (node->var->reg) {
+      println ("  push %s\n", node->var->reg);
+      depth += 8;
+      return;
+    }
     gen_addr (node);
     if (node->ty->kind != TY_ARRAY)
       load (node->ty);
     return;
   case ND_ASSIGN:
+    if (node->lhs->kind == ND_VAR && node->lhs->var->reg) {
+      gen (node->rhs);
+      pop ("rdi");
+      store_reg (node->lhs->var, node->ty->size == 1 ? "dil" : node->ty->size == 4 ? "edi" : "rdi");
+      push ("rdi");
+      return;
+    }
     gen_lval (node->lhs);
     gen (node->rhs);
     store (node->ty);
@@ -78,6 +480,9 @@ static void gen (Node *node) {
   case ND_ADDR:
     gen_addr (node->lhs);
     return;
+  case ND_COND:
+    gen_cond (node);
+    return;
   case ND_DEREF:
     gen (node->lhs);
     if (node->ty->kind != TY_ARRAY)
@@ -85,56 +490,67 @@ static void gen (Node *node) {
     return;
   case ND_IF: {
     int seq = labelseq++;
-    if (node->els == NULL) {
+    int site = new_site (2);	// Executions, then-branch taken
+    long taken = counts ? counts [site + 1] : 0;
+    long not_taken = counts ? counts [site] - taken : 0;
+    emit_count (site);
+
+    // A branch the profile shows to be predictable stays a branch.
+    if (!is_cold (taken, not_taken) && !is_cold (not_taken, taken) && gen_if_select (node))
+      return;
+
+    if (is_cold (taken, not_taken)) {
+      // The else branch (if any) falls through.
+      gen (node->cond);
+      pop ("rax");
+      println ("  cmp rax, 0\n");
+      println ("  jne .L.then.%s.%d\n", funcname, seq);
+      FILE *out = begin_cold ();
+      println (".L.then.%s.%d:\n", funcname, seq);
+      gen (node->then);
+      println ("  jmp .L.end.%s.%d\n", funcname, seq);
+      end_cold (out);
+      if (node->els)
+        gen (node->els);
+      println (".L.end.%s.%d:\n", funcname, seq);
+    } else if (node->els && is_cold (not_taken, taken)) {
       gen (node->cond);
-      printf ("  pop rax\n");
-      printf ("  cmp rax, 0\n");
-      printf ("  je .Lend%03d\n", seq);
+      pop ("rax");
+      println ("  cmp rax, 0\n");
+      println ("  je .L.else.%s.%d\n", funcname, seq);
       gen (node->then);
-      printf (".Lend%03d:\n", seq);
+      FILE *out = begin_cold ();
+      println (".L.else.%s.%d:\n", funcname, seq);
+      gen (node->els);
+      println ("  jmp .L.end.%s.%d\n", funcname, seq);
+      end_cold (out);
+      println (".L.end.%s.%d:\n", funcname, seq);
+    } else if (node->els == NULL) {
+      gen (node->cond);
+      pop ("rax");
+      println ("  cmp rax, 0\n");
+      println ("  je .L.end.%s.%d\n", funcname, seq);
+      emit_count (site + 1);
+      gen (node->then);
+      println (".L.end.%s.%d:\n", funcname, seq);
     } else {
       gen (node->cond);
-      printf ("  pop rax\n");
-      printf ("  cmp rax, 0\n");
-      printf ("  je .Lelse%03d\n", seq);
+      pop ("rax");
+      println ("  cmp rax, 0\n");
+      println ("  je .L.else.%s.%d\n", funcname, seq);
+      emit_count (site + 1);
       gen (node->then);
-      printf ("  jmp .Lend%03d\n", seq);
-      printf (".Lelse%03d:\n", seq);
+      println ("  jmp .L.end.%s.%d\n", funcname, seq);
+      println (".L.else.%s.%d:\n", funcname, seq);
       gen (node->els);
-      printf (".Lend%03d:\n", seq);
+      println (".L.end.%s.%d:\n", funcname, seq);
     }
     return;
   }
-  case ND_WHILE: {
-    int seq = labelseq++;
-    printf (".Lbegin%03d:\n", seq);
-    gen (node->cond);
-    printf ("  pop rax\n");
-    printf ("  cmp rax, 0\n");
-    printf ("  je .Lend%03d\n", seq);
-    gen (node->then);
-    printf ("  jmp .Lbegin%03d\n", seq);
-    printf (".Lend%03d:\n", seq);
-    return;
-  }
-  case ND_FOR: {
-    int seq = labelseq++;
-    if (node->init != NULL)
-      gen (node->init);
-    printf (".Lbegin%03d:\n", seq);
-    if (node->cond != NULL) {
-      gen (node->cond);
-      printf ("  pop rax\n");
-      printf ("  cmp rax, 0\n");
-      printf ("  je .Lend%03d\n", seq);
-    }
-    gen (node->then);
-    if (node->inc != NULL)
-      gen (node->inc);
-    printf ("  jmp .Lbegin%03d\n", seq);
-    printf (".Lend%03d:\n", seq);
+  case ND_WHILE:
+  case ND_FOR:
+    gen_loop (node);
     return;
-  }
   case ND_BLOCK:
   case ND_STMT_EXPR:
     for (Node *n = node->body; n; n = n->next)
@@ -150,156 +566,492 @@ static void gen (Node *node) {
 
     // Assume: args <= 6
     for (int i = nargs - 1; i >= 0; i--)
-      printf ("  pop %s\n", argreg8 [i]);
+      println ("  pop %s\n", argreg8 [i]);
+    depth -= nargs * 8;
 
-    // We need to align rsp to a 16 byte boundary before
-    // calling a function because of an ABI requirement.
-    int seq = labelseq++;
-    printf ("  mov rax, rsp\n");
-    printf ("  and rax, 15\n");
-    printf ("  jnz .L.call.%d\n", seq);
-    printf ("  mov rax, 0\n");
-    printf ("  call %s\n", node->funcname);
-    printf ("  jmp .L.end.%d\n", seq);
-    printf (".L.call.%d:\n", seq);
-    printf ("  sub rsp, 8\n");
-    printf ("  mov rax, 0\n");
-    printf ("  call %s\n", node->funcname);
-    printf ("  add rsp, 8\n");
-    printf (".L.end.%d:\n", seq);
-    printf ("  push rax\n");
+    emit_count (new_site (1));
+    emit_call (node->funcname);
+
+    // The callee only sets the low bits of rax for a narrow result.
+    if (node->ty->size == 1)
+      println ("  movsx rax, al\n");
+    else if (node->ty->size == 4)
+      println ("  movsxd rax, eax\n");
+    push ("rax");
 
     return;
   }
   case ND_RETURN:
     gen (node->lhs);
-    printf ("  pop rax\n");
-    printf ("  jmp .L.return.%s\n", funcname);
+    pop ("rax");
+    // A return inside a statement expression leaves values behind.
+    if (frameless && depth)
+      println ("  add rsp, %d\n", depth);
+    println ("  jmp .L.return.%s\n", funcname);
     return;
   }
 
   gen (node->lhs);
   gen (node->rhs);
 
-  printf ("  pop rdi\n");
-  printf ("  pop rax\n");
+  pop ("rdi");
+  pop ("rax");
 
   switch (node->kind) {
   case ND_ADD:
-    printf ("  add rax, rdi\n");
+    println ("  add rax, rdi\n");
     break;
   case ND_PTR_ADD:
-    printf ("  imul rdi, %d\n", node->ty->base->size);
-    printf ("  add rax, rdi\n");
+    println ("  imul rdi, %d\n", node->ty->base->size);
+    println ("  add rax, rdi\n");
     break;
   case ND_SUB:
-    printf ("  sub rax, rdi\n");
+    println ("  sub rax, rdi\n");
     break;
   case ND_PTR_SUB:
-    printf ("  imul rdi, %d\n", node->ty->base->size);
-    printf ("  sub rax, rdi\n");
+    println ("  imul rdi, %d\n", node->ty->base->size);
+    println ("  sub rax, rdi\n");
     break;
   case ND_PTR_DIFF:
-    printf ("  sub rax, rdi\n");
-    printf ("  cqo\n");
-    printf ("  mov rdi, %d\n", node->lhs->ty->base->size);
-    printf ("  idiv rdi\n");
+    println ("  sub rax, rdi\n");
+    println ("  cqo\n");
+    println ("  mov rdi, %d\n", node->lhs->ty->base->size);
+    println ("  idiv rdi\n");
     break;
   case ND_MUL:
-    printf ("  imul rax, rdi\n");
+    println ("  imul rax, rdi\n");
     break;
   case ND_DIV:
-    printf ("  cqo\n");
-    printf ("  idiv rdi\n");
+    println ("  cqo\n");
+    println ("  idiv rdi\n");
     break;
   case ND_EQ:
-    printf ("  cmp rax, rdi\n");
-    printf ("  sete al\n");
-    printf ("  movzb rax, al\n");
+    println ("  cmp rax, rdi\n");
+    println ("  sete al\n");
+    println ("  movzb rax, al\n");
     break;
   case ND_NE:
-    printf ("  cmp rax, rdi\n");
-    printf ("  setne al\n");
-    printf ("  movzb rax, al\n");
+    println ("  cmp rax, rdi\n");
+    println ("  setne al\n");
+    println ("  movzb rax, al\n");
     break;
   case ND_LT:
-    printf ("  cmp rax, rdi\n");
-    printf ("  setl al\n");
-    printf ("  movzb rax, al\n");
+    println ("  cmp rax, rdi\n");
+    println ("  setl al\n");
+    println ("  movzb rax, al\n");
     break;
   case ND_LE:
-    printf ("  cmp rax, rdi\n");
-    printf ("  setle al\n");
-    printf ("  movzb rax, al\n");
+    println ("  cmp rax, rdi\n");
+    println ("  setle al\n");
+    println ("  movzb rax, al\n");
     break;
   }
 
-  printf ("  push rax\n");
+  push ("rax");
 }
 
 static void load_arg (Var *var, int idx) {
   int sz = var->ty->size;
-  if (sz == 1) {
-    printf ("  mov [rbp-%d], %s\n", var->offset, argreg1 [idx]);
+  assert (sz == 1 || sz == 4 || sz == 8);
+  char *reg = sz == 1 ? argreg1 [idx] : sz == 4 ? argreg4 [idx] : argreg8 [idx];
+
+  if (var->reg)
+    store_reg (var, reg);
+  else if (frameless)
+    println ("  mov [rsp+%d], %s\n", sp_offset (var->offset), reg);
+  else
+    println ("  mov [rbp-%d], %s\n", var->offset, reg);
+}
+
+// Function entry and exit hooks for -finstrument-functions. Called
+// after the arguments are saved and before the return value is set,
+// so only rax needs to be preserved (by the caller, on exit).
+static void emit_trace (bool is_exit) {
+  if (opt_instrument == INSTR_CALLS) {
+    println ("  mov rdi, offset %s\n", funcname);
+    println ("  mov rsi, [rbp+8]\n");	// Call site
+    emit_call (is_exit ? "__cyg_profile_func_exit" : "__cyg_profile_func_enter");
+    return;
+  }
+
+  // Inline mode: append { tsc << 1 | is_exit, function } to the
+  // thread's ring buffer (__dcc_trace in runtime/trace.c).
+  println ("  rdtsc\n");
+  println ("  shl rdx, 32\n");
+  println ("  or rax, rdx\n");
+  println ("  shl rax, 1\n");
+  if (is_exit)
+    println ("  or rax, 1\n");
+  println ("  mov rcx, QWORD PTR fs:0\n");
+  println ("  lea rcx, [rcx+__dcc_trace@tpoff]\n");
+  println ("  mov rdx, [rcx]\n");
+  println ("  inc QWORD PTR [rcx]\n");
+  println ("  and rdx, %d\n", TRACE_RING_SIZE - 1);
+  println ("  shl rdx, 4\n");
+  println ("  add rdx, rcx\n");
+  println ("  mov [rdx+8], rax\n");
+  println ("  mov rax, offset %s\n", funcname);
+  println ("  mov [rdx+16], rax\n");
+}
+
+// Emits a NUL-terminated string as bytes.
+static void emit_string (char *s) {
+  for (;; s++) {
+    println ("  .byte 0x%x\n", *s);
+    if (!*s)
+      break;
+  }
+}
+
+// Data directive for an integer of the given size
+// The directive is part of the format, so that println () does not
+// count data as instructions.
+static void emit_value (int size, int val) {
+  if (size == 1)
+    println ("  .byte %d\n", val);
+  else if (size == 4)
+    println ("  .long %d\n", val);
+  else
+    println ("  .quad %d\n", val);
+}
+
+static void emit_global (Var *var) {
+  int align = type_align (var->ty);
+  if (align > 1)
+    println ("  .align %d\n", align);
+  println ("%s:\n", var->name);
+  if (var->contents)
+    for (int i = 0; i < var->cont_len; i++)
+      println ("  .byte 0x%x\n", var->contents [i]);
+  else if (var->val)
+    emit_value (var->ty->size, var->val);
+  else if (var->int_arr)
+    for (int i = 0; i < var->ty->array_len; i++)
+      emit_value (var->ty->base->size, var->int_arr [i]);
+  else
+    println ("  .zero %d\n", var->ty->size);
+}
+
+static void emit_data (VarList *globals) {
+  println ("  .data\n");
+
+  for (VarList *vl = globals; vl; vl = vl->next)
+    emit_global (vl->var);
+}
+
+static bool has_call (Node *node) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+  case ND_NULL:
+  case ND_NUM:
+  case ND_VAR:
+    return false;
+  case ND_FUNCALL:
+    return true;
+  case ND_IF:
+  case ND_COND:
+  case ND_WHILE:
+  case ND_FOR:
+    return has_call (node->cond) || has_call (node->then) ||
+           has_call (node->els) || has_call (node->inc);	// els or init
+  case ND_BLOCK:
+  case ND_STMT_EXPR:
+    for (Node *n = node->body; n; n = n->next)
+      if (has_call (n))
+        return true;
+    return false;
+  default:
+    return has_call (node->lhs) || has_call (node->rhs);
+  }
+}
+
+// A function that calls nothing can do without a frame pointer.
+// Debug info and the instrumentation hooks assume an rbp frame.
+static bool is_frameless (Function *fn) {
+  if (!opt_omit_frame_pointer || opt_g || opt_instrument)
+    return false;
+  for (Node *node = fn->node; node; node = node->next)
+    if (has_call (node))
+      return false;
+  return true;
+}
+
+static void emit_function (Function *fn) {
+  println (".global %s\n", fn->name);
+  if (opt_g)
+    println (".type %s, @function\n", fn->name);
+  println ("%s:\n", fn->name);
+  funcname = fn->name;
+  labelseq = 0;
+  last_line = 0;
+  nsites = 0;
+  counts = fn->profile;
+  cold_file = NULL;
+  frameless = is_frameless (fn);
+  frame_size = fn->stack_size;
+  depth = 0;
+
+  // Prologue. With -g, CFI directives describe the rbp-based
+  // frame so that debuggers and profilers can unwind through it.
+  if (opt_g) {
+    println ("  .cfi_startproc\n");
+    emit_loc (fn->tok);
+  }
+  if (frameless) {
+    if (frame_size)
+      println ("  sub rsp, %d\n", frame_size);
   } else {
-    assert (sz == 8);
-    printf ("  mov [rbp-%d], %s\n", var->offset, argreg8 [idx]);
-  }
-}
-
-static void emit_data (Program *prog) {
-  printf ("  .data\n");
-
-  for (VarList *vl = prog->globals; vl; vl = vl->next) {
-    Var *var = vl->var;
-    printf ("%s:\n", var->name);
-    if (var->contents)
-      for (int i = 0; i < var->cont_len; i++)
-        printf ("  .byte 0x%x\n", var->contents [i]);
-    else if (var->val)
-      printf ("  .long %d\n", var->val);
-    else if (var->int_arr)
-      for (int i = 0; i < var->ty->size; i++)
-        //printf ("  .long %d\n", var->int_arr [i]);
-        printf ("  .quad %d\n", var->int_arr [i]);
+    println ("  push rbp\n");
+    if (opt_g) {
+      println ("  .cfi_def_cfa_offset 16\n");
+      println ("  .cfi_offset rbp, -16\n");
+    }
+    println ("  mov rbp, rsp\n");
+    if (opt_g)
+      println ("  .cfi_def_cfa_register rbp\n");
+    println ("  sub rsp, %d\n", fn->stack_size);
+  }
+  for (int i = 0; i < fn->nsaved; i++) {
+    if (frameless) {
+      println ("  mov [rsp+%d], %s\n", sp_offset (8 * (i + 1)), promote_regs [i]);
+    } else {
+      println ("  mov [rbp-%d], %s\n", 8 * (i + 1), promote_regs [i]);
+      // The CFA is rbp+16, so the slot is 16 bytes further from it.
+      if (opt_g)
+        println ("  .cfi_offset %s, -%d\n", promote_regs [i], 16 + 8 * (i + 1));
+    }
+  }
+  emit_count (new_site (1));
+
+  // Push arguments to the stack
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next)
+    load_arg (vl->var, i++);
+
+  if (opt_instrument)
+    emit_trace (false);
+
+  // Emit code
+  for (Node *node = fn->node; node; node = node->next)
+    gen (node);
+
+  // Epilogue
+  println (".L.return.%s:\n", funcname);
+  if (opt_instrument) {
+    println ("  push rax\n");
+    emit_trace (true);
+    println ("  pop rax\n");
+  }
+  for (int i = 0; i < fn->nsaved; i++) {
+    if (frameless)
+      println ("  mov %s, [rsp+%d]\n", promote_regs [i], sp_offset (8 * (i + 1)));
     else
-      printf ("  .zero %d\n", var->ty->size);
+      println ("  mov %s, [rbp-%d]\n", promote_regs [i], 8 * (i + 1));
+  }
+  if (frameless) {
+    if (frame_size)
+      println ("  add rsp, %d\n", frame_size);
+  } else {
+    println ("  mov rsp, rbp\n");
+    println ("  pop rbp\n");
+  }
+  if (opt_g) {
+    if (cold_file)
+      println ("  .cfi_remember_state\n");
+    println ("  .cfi_def_cfa rsp, 8\n");
+  }
+  println ("  ret\n");
+
+  // Rarely executed blocks, out of the way of the hot path
+  if (cold_file) {
+    if (opt_g)
+      println ("  .cfi_restore_state\n");
+    fclose (cold_file);
+    fwrite (cold_buf, 1, cold_len, output_file);
+    free (cold_buf);
+    cold_file = NULL;
+  }
+
+  if (opt_g) {
+    println ("  .cfi_endproc\n");
+    println (".size %s, .-%s\n", fn->name, fn->name);
   }
+
+  // Counters and their descriptor for the profile runtime
+  if (opt_profile_generate) {
+    println ("  .data\n");
+    println ("  .align 8\n");
+    println (".L.prof.%s:\n", funcname);
+    println ("  .zero %d\n", nsites * 8);
+    println (".L.prof.name.%s:\n", funcname);
+    emit_string (funcname);
+    println ("  .section dcc_prof, \"aw\"\n");
+    println ("  .quad .L.prof.name.%s\n", funcname);
+    println ("  .quad .L.prof.%s\n", funcname);
+    println ("  .quad %d\n", nsites);
+    println ("  .text\n");
+  }
+
+  // Address to name table for the trace runtime
+  if (opt_instrument) {
+    println ("  .data\n");
+    println (".L.sym.%s:\n", funcname);
+    emit_string (funcname);
+    println ("  .section dcc_syms, \"aw\"\n");
+    println ("  .quad %s\n", funcname);
+    println ("  .quad .L.sym.%s\n", funcname);
+    println ("  .text\n");
+  }
+
+  // String literals used by this function
+  if (fn->literals) {
+    println ("  .data\n");
+    for (VarList *vl = fn->literals; vl; vl = vl->next)
+      emit_global (vl->var);
+    println ("  .text\n");
+  }
+}
+
+// Functions are independent of each other once their frames are
+// laid out, so they can be generated on worker threads. Each
+// function is written to its own buffer and the buffers are
+// concatenated in source order afterwards.
+typedef struct {
+  Function **fns;
+  long *insns;	// Instructions emitted for each function
+
+  // Needed by error_tok () on the worker threads
+  char *filename;
+  char *user_input;
+} CodegenJobs;
+
+static void emit_function_job (int idx, void *arg) {
+  CodegenJobs *jobs = arg;
+  Function *fn = jobs->fns [idx];
+  if (fn->text)
+    return;
+
+  filename = jobs->filename;
+  user_input = jobs->user_input;
+
+  // Count into a per-job slot; the caller's stats may live
+  // on a different thread.
+  long insns = stats.insns;
+  output_file = open_memstream (&fn->text, &fn->text_len);
+  emit_function (fn);
+  fclose (output_file);
+  jobs->insns [idx] = stats.insns - insns;
+  stats.insns = insns;
 }
 
 static void emit_text (Program *prog) {
-  printf ("  .text\n");
+  println ("  .text\n");
 
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    printf (".global %s\n", fn->name);
-    printf ("%s:\n", fn->name);
-    funcname = fn->name;
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  // Incremental recompilation needs each function's code
+  // separately, so it always goes through the buffers.
+  if (!opt_incremental && (opt_codegen_threads <= 1 || nfns <= 1)) {
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+      emit_function (fn);
+    return;
+  }
 
-    // Prologue
-    printf ("  push rbp\n");
-    printf ("  mov rbp, rsp\n");
-    printf ("  sub rsp, %d\n", fn->stack_size);
+  CodegenJobs jobs = {
+    .fns = calloc (nfns, sizeof (Function *)),
+    .insns = calloc (nfns, sizeof (long)),
+    .filename   = filename,
+    .user_input = user_input,
+  };
 
-    // Push arguments to the stack
-    int i = 0;
-    for (VarList *vl = fn->params; vl; vl = vl->next)
-      load_arg (vl->var, i++);
+  int i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    jobs.fns [i++] = fn;
 
-    // Emit code
-    for (Node *node = fn->node; node; node = node->next)
-      gen (node);
+  FILE *out = output_file;
+  run_jobs (nfns, opt_codegen_threads, emit_function_job, &jobs);
+  output_file = out;
 
-    // Epilogue
-    printf (".L.return.%s:\n", funcname);
-    printf ("  mov rsp, rbp\n");
-    printf ("  pop rbp\n");
-    printf ("  ret\n");
+  for (i = 0; i < nfns; i++)
+    stats.insns += jobs.insns [i];
+
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    fwrite (fn->text, 1, fn->text_len, output_file);
+    if (!opt_incremental) {
+      free (fn->text);
+      fn->text = NULL;
+    }
   }
+
+  free (jobs.fns);
+  free (jobs.insns);
 }
 
-void codegen (Program *prog) {
-  printf (".intel_syntax noprefix\n");
-  emit_data (prog);
+// With -fprofile-use, functions that never ran in the profile are
+// moved to the end of .text, away from the code that did.
+static void layout_functions (Program *prog) {
+  Function hot = {}, cold = {};
+  Function *h = &hot, *c = &cold;
+
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    if (!fn->text)
+      fn->profile = profile_counts (fn);
+    if (fn->profile && fn->profile [0] == 0)
+      c = c->next = fn;
+    else
+      h = h->next = fn;
+  }
+
+  c->next = NULL;
+  h->next = cold.next;
+  prog->fns = hot.next;
+}
+
+static void emit_header (FILE *out) {
+  output_file = out;
+  println (".intel_syntax noprefix\n");
+  if (opt_g)
+    println (".file 1 \"%s\"\n", filename);
+}
+
+void codegen (Program *prog, FILE *out) {
+  if (opt_profile_use)
+    layout_functions (prog);
+
+  // The globals go last, as in streaming mode, so that both modes
+  // produce the same output.
+  emit_header (out);
   emit_text (prog);
+  emit_data (prog->globals);
 }
 
+// Streaming mode (-fstreaming) emits each function as soon as it is
+// parsed, and the globals once the whole file has been seen.
+void codegen_begin (FILE *out) {
+  emit_header (out);
+  println ("  .text\n");
+}
+
+void codegen_function (Function *fn) {
+  if (opt_profile_use)
+    fn->profile = profile_counts (fn);
+  emit_function (fn);
+}
+
+void codegen_end (VarList *globals) {
+  emit_data (globals);
+}
+
+// --precompile keeps the code of the header's functions, without
+// the header and the data that go with a whole file.
+void codegen_text (Program *prog, FILE *out) {
+  if (opt_profile_use)
+    layout_functions (prog);
+
+  output_file = out;
+  emit_text (prog);
+}
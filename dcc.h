@@ -3,13 +3,32 @@
 #include <assert.h>
 #include <ctype.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#define DCC_VERSION "0.2.0"
+
 typedef struct Type Type;
 
+//
+// arena.c
+//
+
+// Bump allocator for objects that are freed all at once
+typedef struct ArenaChunk ArenaChunk;
+
+typedef struct {
+  ArenaChunk *chunks;
+  char *ptr;
+  char *end;
+} Arena;
+
+void *arena_alloc (Arena *arena, size_t size);
+void arena_free (Arena *arena);
+
 //
 // tokenize.c
 //
@@ -24,17 +43,33 @@ typedef enum {
 } TokenKind;
 
 
-// Token type
+// A source file. Tokens point into its contents.
+typedef struct File File;
+struct File {
+  char *name;
+  char *contents;
+  int *line_starts;	// Offset of the first byte of every line
+  int nlines;
+};
+
+// Token type. Tokens are stored contiguously in source order and
+// end with a TK_EOF token, so the next token is simply tok + 1.
 typedef struct Token Token;
 struct Token {
   TokenKind kind; // Token kind
-  Token *next;	  // Next token
-  int val;	  // If kind is TK_NUM, its value
-  char *str;	  // Token string
   int len;	  // Token length
-
+  char *str;	  // Token string
+  union {
+    int val;	  // If kind is TK_NUM, its value
+    int cont_len; // String literal length
+  };
+  short file_no;  // Number of file in .loc directives, 1 for the main file
+  bool at_bol;	  // First token of a line
+  bool noexpand;  // Not to be macro-expanded
   char *contents; // String literal contents including terminating '\0'
-  int cont_len;	  // String literal length
+  File *file;	  // Source file
+  int line_no;	  // Line number, starting at 1
+  int col;	  // Byte column, starting at 1
 };
 
 void error (char *fmt, ...);
@@ -48,15 +83,43 @@ void expect (char *op);
 int expect_number (void);
 char *expect_ident (void);
 bool at_eof (void);
+File *new_file (char *name, char *contents);
+void lex_next (Token *tok);
+Token *tokenize_file (File *file, Arena *strings);
 Token *tokenize (void);
+void tokenize_begin (void);
+Token *tokenize_item (void);
+void tokenize_release (Token **toks, Arena *strings);
 void print_tokens (Token *head);
 
-extern char *filename;
-extern char *user_input;
-extern Token *token;
+// Per-compilation state. Each worker thread compiles one
+// translation unit at a time, so these are thread-local.
+extern _Thread_local char *filename;
+extern _Thread_local char *user_input;
+extern _Thread_local Token *token;
 extern char *TokenKindStr [];
 
 
+//
+// preprocess.c
+//
+
+typedef struct {
+  char *name;
+  bool is_func;
+  bool has_paste;	// Body contains "##"
+  Token *params;
+  int nparams;
+  Token *body;		// Terminated by TK_EOF
+} Macro;
+
+typedef struct Pch Pch;
+
+void add_include_path (char *dir);
+void preprocess_begin (File *file, short file_no);
+void preprocess_next (Token *tok);
+void preprocess_export (Pch *p);
+
 //
 //  parse.c
 //
@@ -87,6 +150,9 @@ struct Var {
   // String literal
   char *contents;
   int cont_len;
+
+  // Register the local lives in with -O, or NULL
+  char *reg;
 };
 
 typedef struct VarList VarList;
@@ -112,6 +178,7 @@ typedef enum {
   ND_ADDR,	// unary &
   ND_DEREF,	// unary *
   ND_ASSIGN,	// =
+  ND_COND,	// ?:
   ND_VAR,	// Local variable
   ND_FUNCALL,	// function call
   ND_NUM,	// Integer
@@ -131,31 +198,46 @@ typedef enum {
 
 // AST node type
 typedef struct Node Node;
+//
+// Operands are kind-specific and share storage, which keeps a node
+// at 64 bytes. Code that walks the tree must look at the kind
+// before following any operand.
 struct Node {
   NodeKind kind;
-  Node *next;
+  Node *next;	// Next statement, or next argument of a call
   Type *ty;	// Type, e.g. int or pointer to int
   Token *tok;	// Representative token
 
-  Node *lhs;	// left-hand side
-  Node *rhs;	// right-hand side
-
-  // "if", "while", or "for" statement
-  Node *cond;
-  Node *then;
-  Node *els;
-  Node *init;
-  Node *inc;
-
-  // Block or Statement-expression
-  Node *body;
-
-  // Function call
-  char *funcname;
-  Node *args;
-
-  int val;	// used if kind == ND_NUM
-  Var *var;	// used if kind == ND_LVAR
+  union {
+    // Operators, "return" and expression statements
+    struct {
+      Node *lhs;	// left-hand side
+      Node *rhs;	// right-hand side
+    };
+
+    // "if", "while", or "for" statement, or "?:"
+    struct {
+      Node *cond;
+      Node *then;
+      union {
+        Node *els;	// "if"
+        Node *init;	// "for"
+      };
+      Node *inc;	// "for"
+    };
+
+    // Block or Statement-expression
+    Node *body;
+
+    // Function call
+    struct {
+      char *funcname;
+      Node *args;
+    };
+
+    int val;	// used if kind == ND_NUM
+    Var *var;	// used if kind == ND_VAR
+  };
 };
 
 
@@ -163,12 +245,21 @@ typedef struct Function Function;
 struct Function {
   Function *next;
   char *name;
+  Token *tok;	// Function name
   Type *ty;
   VarList *params;
 
   Node *node;
   VarList *locals;
+  VarList *literals;	// String literals used in this function
   int stack_size;
+  int nsaved;	// Callee-saved registers used by promoted locals
+  long *profile;	// Counts from -fprofile-use, if any
+
+  // Generated assembly. Set in advance when the function is
+  // reused by incremental recompilation.
+  char *text;
+  size_t text_len;
 };
 
 
@@ -179,6 +270,12 @@ struct Program {
 };
 
 Program *program (void);
+void parse_begin (void);
+Function *parse_item (void);
+void parse_end_function (void);
+void parse_release (Arena *arena);
+VarList *parse_globals (void);
+VarList *parse_functions (void);
 
 //
 // type.c
@@ -187,27 +284,203 @@ Program *program (void);
 typedef enum {
   TY_CHAR,
   TY_INT,
+  TY_LONG,
   TY_PTR,
   TY_ARRAY,
 } TypeKind;
 
+// Types are interned: each type caches the pointer to it and the
+// arrays of it, so there is one object per distinct type and two
+// types are equal if and only if they are the same pointer. The
+// caches are shared by all compilation threads.
 struct Type {
   TypeKind kind;
   int size;	// sizeof () value
   Type *base;
   int array_len;
+
+  _Atomic (Type *) pointer;	// Pointer to this type
+  _Atomic (Type *) arrays;	// Arrays of this type, linked by next
+  Type *next;
 };
 
 extern Type *char_type;
 extern Type *int_type;
+extern Type *long_type;
 
 bool is_integer (Type *ty);
+int type_align (Type *ty);
 Type *pointer_to (Type *base);
 Type *array_of (Type *base, int len);
-void add_type (Node *node);
+void set_type (Node *node);
+void check_types (Node *node);
 
 /*
  *  codegen.c
  */
 
-void codegen (Program *prog);
+// Events in a thread's trace ring buffer. Must match runtime/trace.c.
+#define TRACE_RING_SIZE 65536
+
+void codegen (Program *prog, FILE *out);
+void codegen_begin (FILE *out);
+void codegen_function (Function *fn);
+void codegen_end (VarList *globals);
+void codegen_text (Program *prog, FILE *out);
+
+//
+// main.c
+//
+
+char *read_file (char *path);
+
+extern int opt_codegen_threads;
+extern bool opt_incremental;
+extern bool opt_g;
+extern bool opt_profile_generate;
+extern bool opt_profile_use;
+extern bool opt_omit_frame_pointer;
+extern bool opt_O;
+extern bool opt_precompile;
+
+typedef enum {
+  INSTR_NONE,
+  INSTR_CALLS,	// -finstrument-functions
+  INSTR_RDTSC,	// -finstrument-functions=rdtsc
+} InstrumentMode;
+
+extern InstrumentMode opt_instrument;
+
+//
+// cache.c
+//
+
+void fnv1a (unsigned long *h, char *buf, size_t len);
+bool cache_init (void);
+char *cache_key (char *input, char *flags);
+bool cache_lookup (char *key, FILE *out);
+void cache_store (char *key, char *buf, size_t len);
+void cache_finish (bool print_stats);
+
+//
+// opt.c
+//
+
+extern char *promote_regs [];
+void promote_locals (Function *fn);
+
+//
+// profile.c
+//
+
+int profile_ncounters (Function *fn);
+void profile_load (char *path);
+long *profile_counts (Function *fn);
+
+//
+// incremental.c
+//
+
+void incr_begin (char *path, char *flags);
+Function *reuse_function (void);
+void incr_end (Program *prog);
+
+//
+// pch.c
+//
+
+// The header of a precompiled header is compiled as file number 2,
+// so that its code can sit next to that of any main file.
+#define PCH_FILE_NO 2
+
+// A precompiled header: the state a translation unit is in right
+// after it has included the header. Shared by all threads.
+struct Pch {
+  char *flags;		// Codegen flags it was compiled with
+  unsigned long hash;	// Hash of the file
+  Macro **macros;
+  int nmacros;
+  char **once;		// Headers that said #pragma once
+  int nonce;
+  char **files;		// Header path of each .loc file number
+  int nfiles;		// Highest .loc file number in use
+  VarList *globals;
+  VarList *functions;	// Return types of the functions it defines
+  char *text;		// Code of the functions it defines
+  size_t text_len;
+};
+
+extern Pch *pch;
+
+void pch_write (Pch *p, char *path);
+void pch_load (char *path);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  char *key;
+  int keylen;
+  void *val;
+} HashEntry;
+
+typedef struct {
+  HashEntry *buckets;
+  int capacity;
+  int used;
+} HashMap;
+
+void *hashmap_get (HashMap *map, char *key);
+void *hashmap_get2 (HashMap *map, char *key, int keylen);
+void hashmap_put (HashMap *map, char *key, void *val);
+void hashmap_put2 (HashMap *map, char *key, int keylen, void *val);
+
+//
+// jit.c
+//
+
+int jit_run (char *asm_text, int argc, char **argv);
+
+//
+// stats.c
+//
+
+typedef enum {
+  PH_READ,
+  PH_TOKENIZE,
+  PH_PARSE,
+  PH_LAYOUT,
+  PH_CODEGEN,
+  NUM_PHASES,
+} Phase;
+
+typedef struct {
+  double time [NUM_PHASES];	// Seconds spent in each phase
+
+  long tokens;
+  long nodes;
+  long types;
+  long vars;
+  long funcs;
+  long insns;	// Emitted instructions
+} Stats;
+
+extern _Thread_local Stats stats;
+
+double now (void);
+void print_stats (char *path, bool json);
+
+//
+// parallel.c
+//
+
+typedef void (*JobFn) (int idx, void *arg);
+void run_jobs (int njobs, int nthreads, JobFn fn, void *arg);
+
+typedef struct Queue Queue;
+Queue *queue_new (int cap);
+void queue_free (Queue *q);
+void queue_push (Queue *q, void *item);
+void queue_flush (Queue *q);
+void *queue_pop (Queue *q);
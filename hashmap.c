@@ -0,0 +1,77 @@
+#include "dcc.h"
+
+// A string-keyed open-addressing hash table with linear probing.
+// Keys are not copied; they must outlive the map.
+
+#define INIT_SIZE 16
+#define HIGH_WATERMARK 70
+
+static unsigned long hash_key (char *key, int keylen) {
+  unsigned long h = 0xcbf29ce484222325UL;
+  fnv1a (&h, key, keylen);
+  return h;
+}
+
+static bool match (HashEntry *ent, char *key, int keylen) {
+  return ent->key && ent->keylen == keylen && !memcmp (ent->key, key, keylen);
+}
+
+static void rehash (HashMap *map) {
+  int cap = map->capacity ? map->capacity * 2 : INIT_SIZE;
+  HashEntry *old = map->buckets;
+  int oldcap = map->capacity;
+
+  map->buckets = calloc (cap, sizeof (HashEntry));
+  map->capacity = cap;
+  map->used = 0;
+
+  for (int i = 0; i < oldcap; i++)
+    if (old [i].key)
+      hashmap_put2 (map, old [i].key, old [i].keylen, old [i].val);
+  free (old);
+}
+
+void *hashmap_get2 (HashMap *map, char *key, int keylen) {
+  if (!map->buckets)
+    return NULL;
+
+  unsigned long h = hash_key (key, keylen);
+  for (int i = 0; i < map->capacity; i++) {
+    HashEntry *ent = &map->buckets [(h + i) % map->capacity];
+    if (match (ent, key, keylen))
+      return ent->val;
+    if (!ent->key)
+      return NULL;
+  }
+  return NULL;
+}
+
+void *hashmap_get (HashMap *map, char *key) {
+  return hashmap_get2 (map, key, strlen (key));
+}
+
+void hashmap_put2 (HashMap *map, char *key, int keylen, void *val) {
+  if (!map->buckets || map->used * 100 / map->capacity >= HIGH_WATERMARK)
+    rehash (map);
+
+  unsigned long h = hash_key (key, keylen);
+  for (int i = 0; i < map->capacity; i++) {
+    HashEntry *ent = &map->buckets [(h + i) % map->capacity];
+    if (match (ent, key, keylen)) {
+      ent->val = val;
+      return;
+    }
+    if (!ent->key) {
+      ent->key = key;
+      ent->keylen = keylen;
+      ent->val = val;
+      map->used++;
+      return;
+    }
+  }
+  assert (0);
+}
+
+void hashmap_put (HashMap *map, char *key, void *val) {
+  hashmap_put2 (map, key, strlen (key), val);
+}
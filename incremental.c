@@ -0,0 +1,300 @@
+#include "dcc.h"
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Incremental per-function recompilation (-fincremental).
+//
+// Before parsing, the token list is split into top-level items and
+// every function definition is fingerprinted over its own tokens,
+// the declarations of the globals it mentions and the signatures of
+// the functions it calls. The generated code of each function is
+// saved with its fingerprint in a sidecar file next to the input
+// ("foo.c.dcci"). On the next compilation, the parser skips functions
+// whose fingerprint is unchanged and codegen emits their saved code.
+
+typedef struct FnPrint FnPrint;
+struct FnPrint {
+  FnPrint *next;
+  char *name;
+  Token *start;	// First token of the definition
+  Token *end;	// Token following the closing brace
+  char hash [33];
+
+  // Saved code, if the fingerprint matched
+  char *text;
+  size_t text_len;
+};
+
+// Token range of a global declaration or a function signature
+typedef struct {
+  Token *start;
+  Token *end;
+} Decl;
+
+// Entry read back from the sidecar file
+typedef struct {
+  char hash [33];
+  char *text;
+  size_t text_len;
+} SavedFn;
+
+static _Thread_local FnPrint *prints;
+static _Thread_local FnPrint *next_print;
+static _Thread_local HashMap print_map;
+static _Thread_local char *sidecar_path;
+static _Thread_local char *header;
+static _Thread_local int nsaved;
+static _Thread_local int nreused;
+
+static bool equal (Token *tok, char *op) {
+  return tok->kind == TK_RESERVED && strlen (op) == tok->len &&
+         !strncmp (tok->str, op, tok->len);
+}
+
+// Returns the token following the group that starts at tok.
+static Token *skip_group (Token *tok, char *open, char *close) {
+  int depth = 0;
+  for (; tok->kind != TK_EOF; tok++) {
+    if (equal (tok, open))
+      depth++;
+    else if (equal (tok, close) && --depth == 0)
+      return tok + 1;
+  }
+  return tok;
+}
+
+// With -g, the saved code carries .loc directives, so moving a
+// function to other lines must invalidate it as well.
+static void hash_tokens (unsigned long *h, Token *start, Token *end) {
+  for (Token *tok = start; tok != end; tok++) {
+    for (int i = 0; i < 2; i++) {
+      fnv1a (&h [i], tok->str, tok->len);
+      fnv1a (&h [i], "", 1);
+      if (opt_g) {
+        fnv1a (&h [i], (char *) &tok->line_no, sizeof (tok->line_no));
+        fnv1a (&h [i], (char *) &tok->col, sizeof (tok->col));
+        fnv1a (&h [i], (char *) &tok->file_no, sizeof (tok->file_no));
+      }
+    }
+  }
+}
+
+static Decl *new_decl (Token *start, Token *end) {
+  Decl *decl = calloc (1, sizeof (Decl));
+  decl->start = start;
+  decl->end   = end;
+  return decl;
+}
+
+// Splits the token list into top-level items.
+static void scan (Token *tok, HashMap *gvars, HashMap *sigs) {
+  FnPrint head = {};
+  FnPrint *cur = &head;
+
+  while (tok->kind != TK_EOF) {
+    Token *start = tok;
+    Token *name  = NULL;
+    for (; tok->kind != TK_EOF && !name; tok++)
+      if (tok->kind == TK_IDENT)
+        name = tok;
+    if (!name)
+      break;
+
+    if (equal (tok, "(")) {
+      // Function definition
+      Token *sig_end = skip_group (tok, "(", ")");
+      hashmap_put2 (sigs, name->str, name->len, new_decl (start, sig_end));
+
+      FnPrint *fp = calloc (1, sizeof (FnPrint));
+      fp->name  = strndup (name->str, name->len);
+      fp->start = start;
+      fp->end   = tok = skip_group (sig_end, "{", "}");
+      cur = cur->next = fp;
+      hashmap_put (&print_map, fp->name, fp);
+      continue;
+    }
+
+    // Global variable
+    int depth = 0;
+    for (; tok->kind != TK_EOF; tok++) {
+      if (equal (tok, "{"))
+        depth++;
+      else if (equal (tok, "}"))
+        depth--;
+      else if (equal (tok, ";") && depth == 0)
+        break;
+    }
+    if (tok->kind != TK_EOF)
+      tok++;
+    hashmap_put2 (gvars, name->str, name->len, new_decl (start, tok));
+  }
+
+  prints = head.next;
+}
+
+// A function's fingerprint covers its own tokens and every
+// declaration its code depends on.
+static void fingerprint (FnPrint *fp, HashMap *gvars, HashMap *sigs) {
+  unsigned long h [2] = { 0xcbf29ce484222325UL, 0x84222325cbf29ce4UL };
+  hash_tokens (h, fp->start, fp->end);
+
+  for (Token *tok = fp->start; tok != fp->end; tok++) {
+    if (tok->kind != TK_IDENT)
+      continue;
+
+    Decl *decl = NULL;
+    if (equal (tok + 1, "("))
+      decl = hashmap_get2 (sigs, tok->str, tok->len);
+    else
+      decl = hashmap_get2 (gvars, tok->str, tok->len);
+
+    if (decl)
+      hash_tokens (h, decl->start, decl->end);
+  }
+
+  sprintf (fp->hash, "%016lx%016lx", h [0], h [1]);
+}
+
+static char *read_sidecar (size_t *len) {
+  FILE *fp = fopen (sidecar_path, "r");
+  if (!fp)
+    return NULL;
+
+  char *buf;
+  FILE *mem = open_memstream (&buf, len);
+  char tmp [65536];
+  size_t n;
+  while ((n = fread (tmp, 1, sizeof (tmp), fp)) > 0)
+    fwrite (tmp, 1, n, mem);
+  fclose (mem);
+  fclose (fp);
+  return buf;
+}
+
+// Reads the sidecar file and attaches saved code to
+// every function whose fingerprint still matches.
+static void load_sidecar (void) {
+  size_t len;
+  char *buf = read_sidecar (&len);
+  if (!buf)
+    return;
+
+  char *end = buf + len;
+  char *p = strchr (buf, '\n');
+  if (!p || p - buf != strlen (header) || strncmp (buf, header, p - buf))
+    return;	// Different compiler version or flags
+  p++;
+
+  HashMap saved = {};
+  while (p < end) {
+    // Each entry is "<name> <hash> <length>\n" followed by the code.
+    // The line is copied out because sscanf () may scan to the end
+    // of its input string, which is the whole file here.
+    char *eol = memchr (p, '\n', end - p);
+    if (!eol || eol - p >= 512)
+      break;
+    char line [512];
+    memcpy (line, p, eol - p);
+    line [eol - p] = '\0';
+
+    char name [256];
+    SavedFn *fn = calloc (1, sizeof (SavedFn));
+    if (sscanf (line, "%255s %32s %zu", name, fn->hash, &fn->text_len) != 3 ||
+        eol + 1 + fn->text_len > end)
+      break;
+
+    fn->text = eol + 1;
+    p = fn->text + fn->text_len;
+    hashmap_put (&saved, strdup (name), fn);
+    nsaved++;
+  }
+
+  for (FnPrint *fp = prints; fp; fp = fp->next) {
+    SavedFn *fn = hashmap_get (&saved, fp->name);
+    if (fn && !strcmp (fn->hash, fp->hash)) {
+      fp->text = fn->text;
+      fp->text_len = fn->text_len;
+    }
+  }
+}
+
+// Called after tokenize (): fingerprints every function
+// in the token list and loads the previously saved code.
+void incr_begin (char *path, char *flags) {
+  prints = NULL;
+  print_map = (HashMap) {};
+  nsaved = nreused = 0;
+
+  sidecar_path = calloc (1, strlen (path) + 6);
+  sprintf (sidecar_path, "%s.dcci", path);
+  header = calloc (1, strlen (DCC_VERSION) + strlen (flags) + 20);
+  sprintf (header, "dcc-incremental %s %s", DCC_VERSION, flags);
+
+  HashMap gvars = {};
+  HashMap sigs  = {};
+  scan (token, &gvars, &sigs);
+  for (FnPrint *fp = prints; fp; fp = fp->next)
+    fingerprint (fp, &gvars, &sigs);
+
+  next_print = prints;
+  load_sidecar ();
+}
+
+// Called by the parser at the start of each function definition.
+// If the function is unchanged, skips its tokens and returns a
+// Function carrying the saved code. Otherwise returns NULL.
+Function *reuse_function (void) {
+  FnPrint *fp = next_print;
+  if (!fp || fp->start != token)
+    return NULL;
+  next_print = fp->next;
+
+  if (!fp->text)
+    return NULL;
+
+  Function *fn = calloc (1, sizeof (Function));
+  fn->name = fp->name;
+  fn->text = fp->text;
+  fn->text_len = fp->text_len;
+  token = fp->end;
+  nreused++;
+  return fn;
+}
+
+// Called after codegen (): saves each function's code
+// with its fingerprint for the next compilation.
+void incr_end (Program *prog) {
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  // Nothing changed since the last compilation.
+  if (nreused == nfns && nsaved == nfns)
+    return;
+
+  // Other threads of this process may be writing the sidecar of the
+  // same input, so the temporary name must be unique.
+  char *tmp = calloc (1, strlen (sidecar_path) + 8);
+  sprintf (tmp, "%s.XXXXXX", sidecar_path);
+
+  int fd = mkstemp (tmp);
+  if (fd == -1)
+    error ("cannot open %s: %s", tmp, strerror (errno));
+  fchmod (fd, 0644);
+  FILE *fp = fdopen (fd, "w");
+
+  fprintf (fp, "%s\n", header);
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    FnPrint *print = hashmap_get (&print_map, fn->name);
+    if (!print || !fn->text)
+      continue;
+    fprintf (fp, "%s %s %zu\n", fn->name, print->hash, fn->text_len);
+    fwrite (fn->text, 1, fn->text_len, fp);
+  }
+
+  if (fclose (fp) || rename (tmp, sidecar_path)) {
+    unlink (tmp);
+    error ("cannot write %s: %s", sidecar_path, strerror (errno));
+  }
+  free (tmp);
+}
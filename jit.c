@@ -0,0 +1,795 @@
+#include "dcc.h"
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// In-memory execution (--run).
+//
+// The assembly produced by codegen () is encoded into machine code by
+// a small assembler that understands the instruction forms dcc emits.
+// The code is mapped into the low 2 GiB (MAP_32BIT), so that absolute
+// 32-bit addresses such as "push offset x" remain valid. Calls to
+// symbols that the program does not define are resolved with dlsym ()
+// and go through a stub that jumps to the 64-bit address.
+
+typedef struct {
+  unsigned char *buf;
+  int len;
+  int cap;
+} Section;
+
+typedef struct {
+  Section *sec;
+  int offset;
+} Label;
+
+typedef enum {
+  FIX_REL32,	// PC-relative jump or call target
+  FIX_ABS32,	// Sign-extended 32-bit absolute address
+  FIX_ABS64,	// 64-bit absolute address
+} FixupKind;
+
+typedef struct Fixup Fixup;
+struct Fixup {
+  Fixup *next;
+  FixupKind kind;
+  Section *sec;
+  int offset;
+  char *sym;
+  long addend;
+};
+
+typedef enum {
+  OP_REG,
+  OP_IMM,
+  OP_MEM,	// [base+disp] or [sym+disp]
+  OP_SYM,	// label or "offset label"
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;	// Operand size in bytes, 0 if unknown
+  int reg;	// Register, or base register of a memory operand
+  long imm;	// Immediate value or displacement
+  char *sym;	// Symbol, or symbolic displacement of a memory operand
+} Operand;
+
+static Section text;
+static Section data;
+static Section *cur;
+static HashMap labels;
+static Fixup *fixups;
+static int lineno;
+static char *line;
+
+static void jit_error (char *msg) {
+  error ("jit: line %d: %s: %s", lineno, msg, line);
+}
+
+//
+// Output buffers
+//
+
+static void emit8 (int c) {
+  if (cur->len == cur->cap) {
+    cur->cap = cur->cap ? cur->cap * 2 : 4096;
+    cur->buf = realloc (cur->buf, cur->cap);
+  }
+  cur->buf [cur->len++] = c;
+}
+
+static void emit32 (long v) {
+  for (int i = 0; i < 4; i++)
+    emit8 (v >> (i * 8));
+}
+
+static void emit64 (long v) {
+  for (int i = 0; i < 8; i++)
+    emit8 (v >> (i * 8));
+}
+
+static void add_fixup (FixupKind kind, char *sym, long addend) {
+  Fixup *fix = calloc (1, sizeof (Fixup));
+  fix->kind   = kind;
+  fix->sec    = cur;
+  fix->offset = cur->len;
+  fix->sym    = sym;
+  fix->addend = addend;
+  fix->next   = fixups;
+  fixups = fix;
+}
+
+//
+// Operand parsing
+//
+
+static char *regs64 [] = {
+  "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+
+static char *regs32 [] = {
+  "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+  "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d",
+};
+
+static char *regs16 [] = {
+  "ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+  "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w",
+};
+
+static char *regs8 [] = {
+  "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+  "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b",
+};
+
+// Returns the register number and sets *size, or returns -1.
+static int parse_reg (char *s, int len, int *size) {
+  static char **tables [] = { regs64, regs32, regs16, regs8 };
+  static int sizes [] = { 8, 4, 2, 1 };
+
+  for (int t = 0; t < 4; t++) {
+    for (int i = 0; i < 16; i++) {
+      if (strlen (tables [t] [i]) == len && !strncmp (tables [t] [i], s, len)) {
+        *size = sizes [t];
+        return i;
+      }
+    }
+  }
+  return -1;
+}
+
+static bool startswith (char *p, char *q) {
+  return strncmp (p, q, strlen (q)) == 0;
+}
+
+static Operand parse_operand (char *s) {
+  Operand op = {};
+
+  static char *ptrs [] = { "BYTE PTR ", "WORD PTR ", "DWORD PTR ", "QWORD PTR " };
+  static int ptr_sizes [] = { 1, 2, 4, 8 };
+  for (int i = 0; i < 4; i++) {
+    if (startswith (s, ptrs [i])) {
+      op.size = ptr_sizes [i];
+      s += strlen (ptrs [i]);
+    }
+  }
+
+  if (*s == '[') {
+    // [reg], [reg+disp], [reg-disp], [sym] or [sym+disp]
+    op.kind = OP_MEM;
+    op.reg = -1;
+    char *p = s + 1;
+    char *q = p;
+    while (*q && *q != '+' && *q != '-' && *q != ']')
+      q++;
+
+    int size;
+    int reg = parse_reg (p, q - p, &size);
+    if (reg >= 0) {
+      if (size != 8)
+        jit_error ("invalid base register");
+      op.reg = reg;
+    } else {
+      op.sym = strndup (p, q - p);
+    }
+
+    if (*q == '+' || *q == '-')
+      op.imm = strtol (q, &q, 0);
+    if (*q != ']')
+      jit_error ("unsupported memory operand");
+    return op;
+  }
+
+  int size;
+  int reg = parse_reg (s, strlen (s), &size);
+  if (reg >= 0) {
+    op.kind = OP_REG;
+    op.reg  = reg;
+    op.size = size;
+    return op;
+  }
+
+  if (isdigit (*s) || *s == '-') {
+    op.kind = OP_IMM;
+    op.imm  = strtol (s, NULL, 0);
+    return op;
+  }
+
+  if (startswith (s, "offset "))
+    s += 7;
+  op.kind = OP_SYM;
+  op.sym  = strdup (s);
+  return op;
+}
+
+//
+// Instruction encoding
+//
+
+static bool is_mem (Operand *op) {
+  return op->kind == OP_MEM;
+}
+
+static bool is_reg (Operand *op) {
+  return op->kind == OP_REG;
+}
+
+static bool is_rm (Operand *op) {
+  return op->kind == OP_REG || op->kind == OP_MEM;
+}
+
+static bool fits8 (long v) {
+  return -128 <= v && v <= 127;
+}
+
+static bool fits32 (long v) {
+  return -2147483648L <= v && v <= 2147483647L;
+}
+
+// spl, bpl, sil and dil are only addressable with a REX prefix.
+static bool needs_rex8 (Operand *op) {
+  return op && is_reg (op) && op->size == 1 && 4 <= op->reg && op->reg <= 7;
+}
+
+// Emits the REX prefix, if any, for an instruction whose ModRM.reg
+// field holds reg (or an opcode extension) and whose r/m is rm.
+static void emit_rex (int size, int reg, Operand *reg_op, Operand *rm) {
+  int rex = 0;
+  if (size == 8)
+    rex |= 8;
+  if (reg >= 8)
+    rex |= 4;
+  if (rm && rm->reg >= 8)
+    rex |= 1;
+  if (rex || needs_rex8 (reg_op) || needs_rex8 (rm))
+    emit8 (0x40 | rex);
+}
+
+static void emit_modrm (int reg, Operand *rm) {
+  reg &= 7;
+
+  if (is_reg (rm)) {
+    emit8 (0xc0 | (reg << 3) | (rm->reg & 7));
+    return;
+  }
+
+  // Absolute address: SIB with no base and no index
+  if (rm->reg < 0) {
+    emit8 (0x04 | (reg << 3));
+    emit8 (0x25);
+    add_fixup (FIX_ABS32, rm->sym, rm->imm);
+    emit32 (0);
+    return;
+  }
+
+  int base = rm->reg & 7;
+  int mod;
+  if (rm->imm == 0 && base != 5)
+    mod = 0;
+  else if (fits8 (rm->imm))
+    mod = 1;
+  else
+    mod = 2;
+
+  emit8 ((mod << 6) | (reg << 3) | base);
+  if (base == 4)
+    emit8 (0x24);	// SIB for rsp/r12 base
+  if (mod == 1)
+    emit8 (rm->imm);
+  else if (mod == 2)
+    emit32 (rm->imm);
+}
+
+// Emits [0x66] [REX] opcode... ModRM for a generic r/m instruction.
+static void emit_op (int size, int *opcode, int nopcode, int reg, Operand *reg_op, Operand *rm) {
+  if (size == 2)
+    emit8 (0x66);
+  emit_rex (size, reg, reg_op, rm);
+  for (int i = 0; i < nopcode; i++)
+    emit8 (opcode [i]);
+  emit_modrm (reg, rm);
+}
+
+#define OP(size, reg, reg_op, rm, ...) \
+  emit_op (size, (int []) { __VA_ARGS__ }, sizeof ((int []) { __VA_ARGS__ }) / sizeof (int), \
+           reg, reg_op, rm)
+
+static int operand_size (Operand *a, Operand *b) {
+  if (a && a->size)
+    return a->size;
+  if (b && b->size)
+    return b->size;
+  return 8;
+}
+
+static void emit_imm (int size, long imm) {
+  if (size == 1)
+    emit8 (imm);
+  else if (size == 2) {
+    emit8 (imm);
+    emit8 (imm >> 8);
+  } else
+    emit32 (imm);
+}
+
+static char *cond_names [] = {
+  "o", "no", "b", "ae", "e", "ne", "be", "a",
+  "s", "ns", "p", "np", "l", "ge", "le", "g",
+};
+
+static int parse_cond (char *s) {
+  static struct { char *name; int cc; } aliases [] = {
+    { "z", 4 }, { "nz", 5 }, { "c", 2 }, { "nc", 3 }, { "nae", 2 }, { "nb", 3 },
+    { "na", 6 }, { "nbe", 7 }, { "nge", 12 }, { "nl", 13 }, { "ng", 14 }, { "nle", 15 },
+  };
+
+  for (int i = 0; i < 16; i++)
+    if (!strcmp (s, cond_names [i]))
+      return i;
+  for (int i = 0; i < sizeof (aliases) / sizeof (*aliases); i++)
+    if (!strcmp (s, aliases [i].name))
+      return aliases [i].cc;
+  return -1;
+}
+
+static void encode_alu (int ext, Operand *dst, Operand *src) {
+  int size = operand_size (dst, src);
+
+  if (src->kind == OP_IMM) {
+    if (size == 1)
+      OP (size, ext, NULL, dst, 0x80);
+    else if (fits8 (src->imm))
+      OP (size, ext, NULL, dst, 0x83);
+    else
+      OP (size, ext, NULL, dst, 0x81);
+    emit_imm (size == 1 || fits8 (src->imm) ? 1 : (size == 2 ? 2 : 4), src->imm);
+    return;
+  }
+
+  if (is_reg (src) && is_rm (dst)) {
+    OP (size, src->reg, src, dst, (size == 1 ? 0x00 : 0x01) + ext * 8);
+    return;
+  }
+
+  if (is_reg (dst) && is_mem (src)) {
+    OP (size, dst->reg, dst, src, (size == 1 ? 0x02 : 0x03) + ext * 8);
+    return;
+  }
+
+  jit_error ("invalid operands");
+}
+
+static void encode_mov (Operand *dst, Operand *src) {
+  int size = operand_size (dst, src);
+
+  if (is_reg (dst) && src->kind == OP_IMM) {
+    if (size == 8 && fits32 (src->imm)) {
+      OP (8, 0, NULL, dst, 0xc7);
+      emit32 (src->imm);
+      return;
+    }
+    if (size == 2)
+      emit8 (0x66);
+    emit_rex (size, 0, NULL, dst);
+    emit8 ((size == 1 ? 0xb0 : 0xb8) + (dst->reg & 7));
+    if (size == 8)
+      emit64 (src->imm);
+    else
+      emit_imm (size, src->imm);
+    return;
+  }
+
+  if (is_mem (dst) && src->kind == OP_IMM) {
+    OP (size, 0, NULL, dst, size == 1 ? 0xc6 : 0xc7);
+    emit_imm (size == 8 ? 4 : size, src->imm);
+    return;
+  }
+
+  if (is_reg (src) && is_rm (dst)) {
+    OP (size, src->reg, src, dst, size == 1 ? 0x88 : 0x89);
+    return;
+  }
+
+  if (is_reg (dst) && is_mem (src)) {
+    OP (size, dst->reg, dst, src, size == 1 ? 0x8a : 0x8b);
+    return;
+  }
+
+  if (is_reg (dst) && src->kind == OP_SYM && size == 8) {
+    // mov reg, offset sym
+    OP (8, 0, NULL, dst, 0xc7);
+    add_fixup (FIX_ABS32, src->sym, 0);
+    emit32 (0);
+    return;
+  }
+
+  jit_error ("invalid operands");
+}
+
+static void encode_jump (int *opcode, int nopcode, Operand *target) {
+  if (target->kind == OP_REG && nopcode == 1) {
+    // Indirect call or jump through a register
+    OP (4, opcode [0] == 0xe8 ? 2 : 4, NULL, target, 0xff);
+    return;
+  }
+  if (target->kind != OP_SYM)
+    jit_error ("invalid jump target");
+
+  for (int i = 0; i < nopcode; i++)
+    emit8 (opcode [i]);
+  add_fixup (FIX_REL32, target->sym, 0);
+  emit32 (0);
+}
+
+static void encode (char *mn, Operand *ops, int nops) {
+  Operand *a = nops > 0 ? &ops [0] : NULL;
+  Operand *b = nops > 1 ? &ops [1] : NULL;
+
+  static char *alu [] = { "add", "or", "adc", "sbb", "and", "sub", "xor", "cmp" };
+  for (int i = 0; i < 8; i++) {
+    if (!strcmp (mn, alu [i]) && nops == 2) {
+      encode_alu (i, a, b);
+      return;
+    }
+  }
+
+  if (!strcmp (mn, "mov") && nops == 2) {
+    encode_mov (a, b);
+    return;
+  }
+
+  if (!strcmp (mn, "movsx") && nops == 2 && is_reg (a)) {
+    int src_size = b->size ? b->size : 1;
+    OP (a->size, a->reg, a, b, 0x0f, src_size == 1 ? 0xbe : 0xbf);
+    return;
+  }
+
+  if (!strcmp (mn, "movsxd") && nops == 2 && is_reg (a)) {
+    OP (8, a->reg, a, b, 0x63);
+    return;
+  }
+
+  if ((!strcmp (mn, "movzx") || !strcmp (mn, "movzb")) && nops == 2 && is_reg (a)) {
+    int src_size = b->size ? b->size : 1;
+    OP (a->size == 8 ? 8 : 4, a->reg, a, b, 0x0f, src_size == 1 ? 0xb6 : 0xb7);
+    return;
+  }
+
+  if (!strcmp (mn, "lea") && nops == 2 && is_reg (a) && is_mem (b)) {
+    OP (8, a->reg, a, b, 0x8d);
+    return;
+  }
+
+  if (!strcmp (mn, "push") && nops == 1) {
+    if (is_reg (a)) {
+      if (a->reg >= 8)
+        emit8 (0x41);
+      emit8 (0x50 + (a->reg & 7));
+    } else if (a->kind == OP_IMM && fits8 (a->imm)) {
+      emit8 (0x6a);
+      emit8 (a->imm);
+    } else if (a->kind == OP_IMM) {
+      emit8 (0x68);
+      emit32 (a->imm);
+    } else if (a->kind == OP_SYM) {
+      emit8 (0x68);
+      add_fixup (FIX_ABS32, a->sym, 0);
+      emit32 (0);
+    } else {
+      OP (4, 6, NULL, a, 0xff);
+    }
+    return;
+  }
+
+  if (!strcmp (mn, "pop") && nops == 1 && is_reg (a)) {
+    if (a->reg >= 8)
+      emit8 (0x41);
+    emit8 (0x58 + (a->reg & 7));
+    return;
+  }
+
+  if (!strcmp (mn, "imul") && is_reg (a)) {
+    if (nops == 2 && b->kind != OP_IMM) {
+      OP (a->size, a->reg, a, b, 0x0f, 0xaf);
+      return;
+    }
+    Operand *src = nops == 3 ? b : a;
+    Operand *imm = nops == 3 ? &ops [2] : b;
+    if (fits8 (imm->imm)) {
+      OP (a->size, a->reg, a, src, 0x6b);
+      emit8 (imm->imm);
+    } else {
+      OP (a->size, a->reg, a, src, 0x69);
+      emit32 (imm->imm);
+    }
+    return;
+  }
+
+  static struct { char *name; int opcode; int ext; } unary [] = {
+    { "not", 0xf7, 2 }, { "neg", 0xf7, 3 }, { "mul", 0xf7, 4 },
+    { "div", 0xf7, 6 }, { "idiv", 0xf7, 7 }, { "inc", 0xff, 0 }, { "dec", 0xff, 1 },
+  };
+  for (int i = 0; i < sizeof (unary) / sizeof (*unary); i++) {
+    if (!strcmp (mn, unary [i].name) && nops == 1) {
+      int size = operand_size (a, NULL);
+      OP (size, unary [i].ext, NULL, a, size == 1 ? unary [i].opcode - 1 : unary [i].opcode);
+      return;
+    }
+  }
+
+  static struct { char *name; int ext; } shifts [] = {
+    { "shl", 4 }, { "sal", 4 }, { "shr", 5 }, { "sar", 7 },
+  };
+  for (int i = 0; i < sizeof (shifts) / sizeof (*shifts); i++) {
+    if (!strcmp (mn, shifts [i].name) && nops == 2) {
+      int size = operand_size (a, NULL);
+      if (b->kind == OP_IMM) {
+        OP (size, shifts [i].ext, NULL, a, 0xc1);
+        emit8 (b->imm);
+      } else {
+        OP (size, shifts [i].ext, NULL, a, 0xd3);	// by cl
+      }
+      return;
+    }
+  }
+
+  if (!strcmp (mn, "test") && nops == 2 && is_reg (b)) {
+    int size = operand_size (a, b);
+    OP (size, b->reg, b, a, size == 1 ? 0x84 : 0x85);
+    return;
+  }
+
+  if (!strcmp (mn, "cqo") && nops == 0) {
+    emit8 (0x48);
+    emit8 (0x99);
+    return;
+  }
+
+  if (!strcmp (mn, "ret") && nops == 0) {
+    emit8 (0xc3);
+    return;
+  }
+
+  if (!strcmp (mn, "nop") && nops == 0) {
+    emit8 (0x90);
+    return;
+  }
+
+  if (!strcmp (mn, "rdtsc") && nops == 0) {
+    emit8 (0x0f);
+    emit8 (0x31);
+    return;
+  }
+
+  if (!strcmp (mn, "jmp") && nops == 1) {
+    encode_jump ((int []) { 0xe9 }, 1, a);
+    return;
+  }
+
+  if (!strcmp (mn, "call") && nops == 1) {
+    encode_jump ((int []) { 0xe8 }, 1, a);
+    return;
+  }
+
+  int cc;
+  if (mn [0] == 'j' && (cc = parse_cond (mn + 1)) >= 0 && nops == 1) {
+    encode_jump ((int []) { 0x0f, 0x80 + cc }, 2, a);
+    return;
+  }
+
+  if (startswith (mn, "set") && (cc = parse_cond (mn + 3)) >= 0 && nops == 1) {
+    OP (1, 0, NULL, a, 0x0f, 0x90 + cc);
+    return;
+  }
+
+  if (startswith (mn, "cmov") && (cc = parse_cond (mn + 4)) >= 0 && nops == 2 && is_reg (a)) {
+    OP (a->size, a->reg, a, b, 0x0f, 0x40 + cc);
+    return;
+  }
+
+  jit_error ("unsupported instruction");
+}
+
+//
+// Directives
+//
+
+static void define_label (char *name) {
+  if (hashmap_get (&labels, name))
+    jit_error ("duplicate label");
+  Label *label = calloc (1, sizeof (Label));
+  label->sec = cur;
+  label->offset = cur->len;
+  hashmap_put (&labels, name, label);
+}
+
+static void directive (char *dir, char *arg) {
+  if (!strcmp (dir, ".text")) {
+    cur = &text;
+  } else if (!strcmp (dir, ".data")) {
+    cur = &data;
+  } else if (!strcmp (dir, ".byte")) {
+    emit8 (strtol (arg, NULL, 0));
+  } else if (!strcmp (dir, ".short")) {
+    emit8 (strtol (arg, NULL, 0));
+    emit8 (strtol (arg, NULL, 0) >> 8);
+  } else if (!strcmp (dir, ".long")) {
+    emit32 (strtol (arg, NULL, 0));
+  } else if (!strcmp (dir, ".quad")) {
+    if (isdigit (*arg) || *arg == '-') {
+      emit64 (strtol (arg, NULL, 0));
+    } else {
+      add_fixup (FIX_ABS64, strdup (arg), 0);
+      emit64 (0);
+    }
+  } else if (!strcmp (dir, ".zero")) {
+    for (long n = strtol (arg, NULL, 0); n > 0; n--)
+      emit8 (0);
+  } else if (!strcmp (dir, ".align")) {
+    long align = strtol (arg, NULL, 0);
+    while (cur->len % align)
+      emit8 (cur == &text ? 0x90 : 0);
+  } else if (!strcmp (dir, ".intel_syntax") || !strcmp (dir, ".global") ||
+             !strcmp (dir, ".file") || !strcmp (dir, ".loc") ||
+             !strcmp (dir, ".type") || !strcmp (dir, ".size") ||
+             startswith (dir, ".cfi_")) {
+    // Nothing to do in memory
+  } else {
+    jit_error ("unsupported directive");
+  }
+}
+
+static void assemble_line (char *s) {
+  while (isspace (*s))
+    s++;
+  if (!*s)
+    return;
+
+  int len = strlen (s);
+  if (s [len - 1] == ':') {
+    define_label (strndup (s, len - 1));
+    return;
+  }
+
+  // Split the mnemonic or directive from its operands.
+  char *p = s;
+  while (*p && !isspace (*p))
+    p++;
+  char *mn = strndup (s, p - s);
+  while (isspace (*p))
+    p++;
+
+  if (*mn == '.') {
+    directive (mn, p);
+    free (mn);
+    return;
+  }
+
+  Operand ops [3];
+  int nops = 0;
+  while (*p) {
+    if (nops == 3)
+      jit_error ("too many operands");
+    char *q = strchr (p, ',');
+    char *end = q ? q : p + strlen (p);
+    char *arg = strndup (p, end - p);
+    ops [nops++] = parse_operand (arg);
+    free (arg);
+    p = q ? q + 1 : end;
+    while (isspace (*p))
+      p++;
+  }
+
+  encode (mn, ops, nops);
+  free (mn);
+}
+
+//
+// Linking and execution
+//
+
+static long page_align (long n) {
+  long page = sysconf (_SC_PAGESIZE);
+  return (n + page - 1) & ~(page - 1);
+}
+
+static void patch (Fixup *fix, unsigned char *base, long target) {
+  unsigned char *p = base + fix->offset;
+  long v = target + fix->addend;
+
+  switch (fix->kind) {
+  case FIX_REL32:
+    v -= (long) (p + 4);
+    if (!fits32 (v))
+      error ("jit: %s: jump target out of range", fix->sym);
+    for (int i = 0; i < 4; i++)
+      p [i] = v >> (i * 8);
+    return;
+  case FIX_ABS32:
+    if (!fits32 (v))
+      error ("jit: %s: address does not fit in 32 bits", fix->sym);
+    for (int i = 0; i < 4; i++)
+      p [i] = v >> (i * 8);
+    return;
+  case FIX_ABS64:
+    for (int i = 0; i < 8; i++)
+      p [i] = v >> (i * 8);
+    return;
+  }
+}
+
+// Assembles asm_text, runs its main () and returns its exit status.
+int jit_run (char *asm_text, int argc, char **argv) {
+  cur = &text;
+  lineno = 0;
+
+  for (char *p = asm_text; *p; ) {
+    char *eol = strchr (p, '\n');
+    if (!eol)
+      eol = p + strlen (p);
+    line = strndup (p, eol - p);
+    lineno++;
+    assemble_line (line);
+    free (line);
+    p = *eol ? eol + 1 : eol;
+  }
+  line = "";
+
+  // Every external symbol gets a stub "jmp [rip+0]; .quad addr".
+  HashMap stubs = {};
+  int nstubs = 0;
+  for (Fixup *fix = fixups; fix; fix = fix->next) {
+    if (!hashmap_get (&labels, fix->sym) && !hashmap_get (&stubs, fix->sym)) {
+      if (!dlsym (RTLD_DEFAULT, fix->sym))
+        error ("jit: undefined symbol: %s", fix->sym);
+      hashmap_put (&stubs, fix->sym, (void *) (long) (text.len + 14 * nstubs++));
+    }
+  }
+
+  long text_size = page_align (text.len + 14 * nstubs);
+  long data_size = page_align (data.len ? data.len : 1);
+  unsigned char *base = mmap (NULL, text_size + data_size, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+  if (base == MAP_FAILED)
+    error ("jit: mmap: %s", strerror (errno));
+
+  unsigned char *text_base = base;
+  unsigned char *data_base = base + text_size;
+  memcpy (text_base, text.buf, text.len);
+  memcpy (data_base, data.buf, data.len);
+
+  for (Fixup *fix = fixups; fix; fix = fix->next) {
+    unsigned char *sec_base = fix->sec == &text ? text_base : data_base;
+    Label *label = hashmap_get (&labels, fix->sym);
+    long target;
+
+    if (label) {
+      target = (long) ((label->sec == &text ? text_base : data_base) + label->offset);
+    } else if (fix->kind == FIX_REL32) {
+      // Calls to external functions go through their stub.
+      long stub = (long) hashmap_get (&stubs, fix->sym);
+      unsigned char *p = text_base + stub;
+      p [0] = 0xff;
+      p [1] = 0x25;
+      memset (p + 2, 0, 4);
+      long addr = (long) dlsym (RTLD_DEFAULT, fix->sym);
+      memcpy (p + 6, &addr, 8);
+      target = (long) p;
+    } else {
+      target = (long) dlsym (RTLD_DEFAULT, fix->sym);
+    }
+
+    patch (fix, sec_base, target);
+  }
+
+  if (mprotect (text_base, text_size, PROT_READ | PROT_EXEC))
+    error ("jit: mprotect: %s", strerror (errno));
+
+  Label *entry = hashmap_get (&labels, "main");
+  if (!entry || entry->sec != &text)
+    error ("jit: main is not defined");
+
+  int (*main_fn) (int, char **) = (void *) (text_base + entry->offset);
+  return main_fn (argc, argv);
+}
@@ -1,4 +1,5 @@
 #include "dcc.h"
+#include <pthread.h>
 
 char *read_file (char *path) {
   // open file
@@ -30,31 +31,604 @@ int align_to (int n, int align) {
   return (n + align - 1) & ~(align - 1);
 }
 
-int
-main (int argc, char *argv [])
-{
-  if (argc != 2) {
-    fprintf (stderr, "usage: %s <number>\n", argv [0]);
-    return 1;
+// Command line options
+static int opt_jobs = 1;
+int opt_codegen_threads = 1;
+bool opt_incremental;
+static bool opt_streaming;
+static bool opt_pipeline;
+bool opt_g;
+bool opt_profile_generate;
+bool opt_profile_use;
+bool opt_omit_frame_pointer;
+bool opt_O;
+bool opt_precompile;
+InstrumentMode opt_instrument;
+static bool opt_verbose;
+static bool opt_cache_stats;
+static bool opt_stats;
+static bool opt_stats_json;
+static char *opt_o;
+static char *opt_profile_path;
+static char *opt_include_pch;
+
+// --run <file> [args...]
+static bool opt_run;
+static int run_argc;
+static char **run_argv;
+
+// Flags that affect the generated code. Part of the cache key.
+static char *codegen_flags = "";
+static bool use_cache;
+
+static char **input_paths;
+static int ninputs;
+
+static void add_codegen_flag (char *flag) {
+  char *buf = calloc (1, strlen (codegen_flags) + strlen (flag) + 2);
+  sprintf (buf, "%s%s%s", codegen_flags, *codegen_flags ? " " : "", flag);
+  codegen_flags = buf;
+}
+
+static void usage (char *argv0) {
+  fprintf (stderr, "usage: %s [-v] [-g] [-O] [-j N] [-I <dir>] [-fincremental] [-ftime-report] [-fstats[=json]]\n"
+           "           [-fprofile-generate] [-fprofile-use[=<profile>]]\n"
+           "           [-finstrument-functions[=rdtsc]] [-fomit-frame-pointer]\n"
+           "           [-fstreaming] [-fpipeline]\n"
+           "           [-include-pch <pch>] [--cache-stats] [-o <file>] <file>...\n"
+           "       %s [options] --run <file> [args...]\n"
+           "       %s [options] --precompile <header> [-o <pch>]\n", argv0, argv0, argv0);
+  exit (1);
+}
+
+static void parse_args (int argc, char **argv) {
+  input_paths = calloc (argc, sizeof (char *));
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp (argv [i], "-v")) {
+      opt_verbose = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-g")) {
+      opt_g = true;
+      add_codegen_flag (argv [i]);
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-O")) {
+      opt_O = true;
+      add_codegen_flag (argv [i]);
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fomit-frame-pointer")) {
+      opt_omit_frame_pointer = true;
+      add_codegen_flag (argv [i]);
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fprofile-generate")) {
+      opt_profile_generate = true;
+      add_codegen_flag (argv [i]);
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fprofile-use") || !strncmp (argv [i], "-fprofile-use=", 14)) {
+      opt_profile_use = true;
+      opt_profile_path = argv [i] [13] ? argv [i] + 14 : "dcc.prof";
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-finstrument-functions")) {
+      opt_instrument = INSTR_CALLS;
+      add_codegen_flag (argv [i]);
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-finstrument-functions=rdtsc")) {
+      opt_instrument = INSTR_RDTSC;
+      add_codegen_flag (argv [i]);
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fstreaming")) {
+      opt_streaming = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fpipeline")) {
+      opt_streaming = opt_pipeline = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fincremental")) {
+      opt_incremental = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-ftime-report") || !strcmp (argv [i], "-fstats")) {
+      opt_stats = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-fstats=json")) {
+      opt_stats = opt_stats_json = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "--cache-stats")) {
+      opt_cache_stats = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "--run")) {
+      // Everything after the file belongs to the program.
+      if (++i == argc)
+        usage (argv [0]);
+      opt_run = true;
+      input_paths [ninputs++] = argv [i];
+      run_argc = argc - i;
+      run_argv = argv + i;
+      break;
+    }
+
+    if (!strcmp (argv [i], "--precompile")) {
+      opt_precompile = true;
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-include-pch")) {
+      if (++i == argc)
+        usage (argv [0]);
+      opt_include_pch = argv [i];
+      continue;
+    }
+
+    if (!strcmp (argv [i], "-o")) {
+      if (++i == argc)
+        usage (argv [0]);
+      opt_o = argv [i];
+      continue;
+    }
+
+    if (!strncmp (argv [i], "-I", 2)) {
+      char *arg = argv [i] [2] ? argv [i] + 2 : argv [++i];
+      if (!arg)
+        usage (argv [0]);
+      add_include_path (arg);
+      continue;
+    }
+
+    if (!strncmp (argv [i], "-j", 2)) {
+      char *arg = argv [i] [2] ? argv [i] + 2 : argv [++i];
+      if (!arg || (opt_jobs = atoi (arg)) <= 0)
+        usage (argv [0]);
+      continue;
+    }
+
+    if (argv [i] [0] == '-' && argv [i] [1] != '\0')
+      error ("unknown argument: %s", argv [i]);
+
+    input_paths [ninputs++] = argv [i];
+  }
+
+  if (ninputs == 0 && !opt_cache_stats)
+    usage (argv [0]);
+  if (opt_o && ninputs > 1)
+    error ("cannot specify -o with multiple files");
+  if (opt_run && ninputs > 1)
+    error ("--run takes exactly one file");
+  if (opt_run && opt_profile_generate)
+    error ("--run does not support -fprofile-generate");
+  if (opt_run && opt_instrument)
+    error ("--run does not support -finstrument-functions");
+  if (opt_profile_generate && opt_profile_use)
+    error ("cannot specify both -fprofile-generate and -fprofile-use");
+  if (opt_streaming && opt_incremental)
+    error ("cannot specify both -fstreaming and -fincremental");
+  if (opt_precompile && ninputs > 1)
+    error ("--precompile takes exactly one file");
+  if (opt_precompile && (opt_run || opt_incremental || opt_include_pch))
+    error ("--precompile does not support --run, -fincremental or -include-pch");
+
+  // The generated code depends on the profile's contents.
+  if (opt_profile_use) {
+    profile_load (opt_profile_path);
+    char *key = cache_key (read_file (opt_profile_path), "");
+    char *flag = calloc (1, strlen (key) + 20);
+    sprintf (flag, "-fprofile-use=%s", key);
+    add_codegen_flag (flag);
+  }
+
+  // So does the code of the precompiled header's functions, which
+  // was generated with the flags it was compiled with.
+  if (opt_include_pch) {
+    pch_load (opt_include_pch);
+    if (strcmp (pch->flags, codegen_flags))
+      error ("%s: compiled with different options: \"%s\"", opt_include_pch, pch->flags);
+    char flag [64];
+    sprintf (flag, "-include-pch=%016lx", pch->hash);
+    add_codegen_flag (flag);
+  }
+}
+
+// Returns the output path for a given input: "foo.c" becomes "foo.s".
+static char *output_path (char *path) {
+  if (opt_o)
+    return opt_o;
+  if (ninputs == 1)
+    return "-";
+
+  char *dot = strrchr (path, '.');
+  char *slash = strrchr (path, '/');
+  int len = (dot && (!slash || slash < dot)) ? dot - path : strlen (path);
+
+  char *buf = calloc (1, len + 3);
+  sprintf (buf, "%.*s.s", len, path);
+  return buf;
+}
+
+// Assigns stack offsets to the local variables of a function.
+// With -O, locals kept in registers need none; the registers are
+// saved at the top of the frame instead.
+static void layout (Function *fn) {
+  if (opt_O)
+    promote_locals (fn);
+
+  int offset = fn->nsaved * 8;
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    if (var->reg)
+      continue;
+    offset = align_to (offset + var->ty->size, type_align (var->ty));
+    var->offset = offset;
+  }
+  fn->stack_size = align_to (offset, 8);
+}
+
+// With -fpipeline, functions are emitted on a thread of their own
+// while the parser moves on to the next one. Each function travels
+// with the memory its nodes point into, which the codegen thread
+// frees once it is done with it. A NULL fn ends the input.
+typedef struct {
+  Function *fn;
+  Arena nodes;
+  Token *tokens;
+  Arena strings;
+  VarList *globals;
+} Unit;
+
+// Bounds the number of parsed functions waiting for codegen
+#define PIPELINE_DEPTH 64
+
+typedef struct {
+  Queue *queue;
+  FILE *out;
+  char *filename;
+  Stats stats;
+} Pipeline;
+
+static void *codegen_thread (void *arg) {
+  Pipeline *p = arg;
+  filename = p->filename;	// For error_tok ()
+  codegen_begin (p->out);
+
+  for (;;) {
+    Unit *u = queue_pop (p->queue);
+    double t = now ();
+    if (!u->fn) {
+      codegen_end (u->globals);
+      stats.time [PH_CODEGEN] += now () - t;
+      free (u);
+      break;
+    }
+
+    codegen_function (u->fn);
+    arena_free (&u->nodes);
+    arena_free (&u->strings);
+    free (u->tokens);
+    free (u);
+    stats.time [PH_CODEGEN] += now () - t;
   }
 
-  filename = argv [1];
-  user_input = read_file (filename);
+  p->stats = stats;
+  return NULL;
+}
+
+static void compile_pipeline (FILE *out) {
+  Pipeline p = { .queue = queue_new (PIPELINE_DEPTH), .out = out, .filename = filename };
+  pthread_t thr;
+  if (pthread_create (&thr, NULL, codegen_thread, &p))
+    error ("pthread_create: %s", strerror (errno));
+
+  tokenize_begin ();
+  parse_begin ();
+
+  for (;;) {
+    double t = now ();
+    token = tokenize_item ();
+    stats.time [PH_TOKENIZE] += now () - t;
+    if (at_eof ())
+      break;
+
+    t = now ();
+    Function *fn = parse_item ();
+    stats.time [PH_PARSE] += now () - t;
+    if (!fn)
+      continue;
+
+    t = now ();
+    layout (fn);
+    stats.time [PH_LAYOUT] += now () - t;
+
+    Unit *u = calloc (1, sizeof (Unit));
+    u->fn = fn;
+    parse_release (&u->nodes);
+    tokenize_release (&u->tokens, &u->strings);
+    queue_push (p.queue, u);
+  }
+
+  Unit *end = calloc (1, sizeof (Unit));
+  end->globals = parse_globals ();
+  queue_push (p.queue, end);
+  queue_flush (p.queue);
+
+  pthread_join (thr, NULL);
+  queue_free (p.queue);
+  stats.time [PH_CODEGEN] += p.stats.time [PH_CODEGEN];
+  stats.insns += p.stats.insns;
+}
+
+// Tokenizes, parses and emits one top-level item at a time, and
+// frees each function once it has been emitted. Peak memory is
+// bounded by the largest function rather than by the whole file.
+static void compile_streaming (FILE *out) {
+  codegen_begin (out);
+  tokenize_begin ();
+  parse_begin ();
+
+  for (;;) {
+    double t = now ();
+    token = tokenize_item ();
+    stats.time [PH_TOKENIZE] += now () - t;
+    if (at_eof ())
+      break;
+
+    t = now ();
+    Function *fn = parse_item ();
+    stats.time [PH_PARSE] += now () - t;
+    if (!fn)
+      continue;
+
+    t = now ();
+    layout (fn);
+    stats.time [PH_LAYOUT] += now () - t;
+
+    t = now ();
+    codegen_function (fn);
+    parse_end_function ();
+    stats.time [PH_CODEGEN] += now () - t;
+  }
+
+  double t = now ();
+  codegen_end (parse_globals ());
+  stats.time [PH_CODEGEN] += now () - t;
+}
+
+static void compile_program (char *path, FILE *out) {
+  double t = now ();
+  token = tokenize ();
+  stats.time [PH_TOKENIZE] += now () - t;
+
+  t = now ();
+  if (opt_incremental)
+    incr_begin (path, codegen_flags);
+  Program *prog = program ();
+  stats.time [PH_PARSE] += now () - t;
+
+  t = now ();
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    layout (fn);
+  stats.time [PH_LAYOUT] += now () - t;
+
+  t = now ();
+  codegen (prog, out);
+  if (opt_incremental)
+    incr_end (prog);
+  stats.time [PH_CODEGEN] += now () - t;
+}
+
+// Compiles one translation unit. All per-compilation state
+// lives in thread-local variables, so this may run on any worker.
+static void compile_file (char *path, char *input, FILE *out) {
+  filename = path;
+  user_input = input;
+
+  if (opt_pipeline)
+    compile_pipeline (out);
+  else if (opt_streaming)
+    compile_streaming (out);
+  else
+    compile_program (path, out);
+
+  // The functions of a precompiled header were compiled with it.
+  if (pch)
+    fwrite (pch->text, 1, pch->text_len, out);
+}
+
+// Compiles a header into a precompiled header (--precompile).
+static void precompile (char *path) {
+  char *opath = opt_o;
+  if (!opath) {
+    opath = calloc (1, strlen (path) + 5);
+    sprintf (opath, "%s.pch", path);
+  }
+
+  filename = path;
+  user_input = read_file (path);
   token = tokenize ();
   Program *prog = program ();
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    layout (fn);
+
+  Pch p = { .flags = codegen_flags, .globals = prog->globals, .functions = parse_functions () };
+  FILE *out = open_memstream (&p.text, &p.text_len);
+  codegen_text (prog, out);
+  fclose (out);
 
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    int offset = 0;
-    for (VarList *vl = fn->locals; vl; vl = vl->next) {
-      Var *var = vl->var;
-      offset += var->ty->size;
-      var->offset = offset;
+  preprocess_export (&p);
+  pch_write (&p, opath);
+}
+
+// Compiles a file into memory and runs its main () in-process.
+static int run_file (char *path) {
+  char *buf;
+  size_t len;
+  FILE *out = open_memstream (&buf, &len);
+  compile_file (path, read_file (path), out);
+  fclose (out);
+
+  if (opt_stats)
+    print_stats (path, opt_stats_json);
+  return jit_run (buf, run_argc, run_argv);
+}
+
+// Returns true if the input may include headers. Matches in comments
+// and strings only make this more conservative.
+static bool has_include (char *input) {
+  for (char *p = input; (p = strchr (p, '#')); p++) {
+    char *q = p + 1;
+    while (*q == ' ' || *q == '\t')
+      q++;
+    if (!strncmp (q, "include", 7))
+      return true;
+  }
+  return false;
+}
+
+// The cache key of an input that includes headers covers its
+// preprocessed tokens rather than its bytes, so that it changes with
+// the headers. With -g, the .loc directives also depend on where each
+// token came from.
+static char *preprocessed_key (char *path, char *input, char *flags) {
+  filename = path;
+  user_input = input;
+
+  double t = now ();
+  Token *tok = tokenize ();
+  stats.time [PH_TOKENIZE] += now () - t;
+
+  char *buf;
+  size_t len;
+  FILE *mem = open_memstream (&buf, &len);
+  for (; tok->kind != TK_EOF; tok++) {
+    if (opt_g)
+      fprintf (mem, "%s:%d:%d:%d ", tok->file->name, tok->file_no, tok->line_no, tok->col);
+    fprintf (mem, "%.*s\n", tok->len, tok->str);
+  }
+  fclose (mem);
+
+  char *key = cache_key (buf, flags);
+  free (buf);
+  return key;
+}
+
+// Elapsed compile time of each input
+static double *elapsed;
+
+static void compile_job (int idx, void *arg) {
+  char *path = input_paths [idx];
+  char *opath = output_path (path);
+
+  double start = now ();
+
+  FILE *out = stdout;
+  if (strcmp (opath, "-")) {
+    out = fopen (opath, "w");
+    if (!out)
+      error ("cannot open output file: %s: %s", opath, strerror (errno));
+  }
+
+  stats = (Stats) {};
+  double t = now ();
+  char *input = read_file (path);
+  stats.time [PH_READ] += now () - t;
+
+  if (use_cache) {
+    // Debug info names the source file, so it is part of the key.
+    char *flags = codegen_flags;
+    if (opt_g) {
+      flags = calloc (1, strlen (codegen_flags) + strlen (path) + 2);
+      sprintf (flags, "%s %s", codegen_flags, path);
     }
-    fn->stack_size = align_to (offset, 8);
+    bool preprocessed = has_include (input);
+    char *key = preprocessed ? preprocessed_key (path, input, flags)
+                             : cache_key (input, flags);
+    if (!cache_lookup (key, out)) {
+      char *buf;
+      size_t len;
+      FILE *mem = open_memstream (&buf, &len);
+      // Headers are lexed once, so the tokens counted for the key
+      // are the ones a compile counts.
+      long ntokens = stats.tokens;
+      compile_file (path, input, mem);
+      if (preprocessed)
+        stats.tokens = ntokens;
+      fclose (mem);
+
+      cache_store (key, buf, len);
+      fwrite (buf, 1, len, out);
+      free (buf);
+    }
+    free (key);
+  } else {
+    compile_file (path, input, out);
   }
 
-  codegen (prog);
+  if (out == stdout)
+    fflush (out);
+  else
+    fclose (out);
 
-  return 0;
+  elapsed [idx] = now () - start;
+
+  if (opt_stats)
+    print_stats (path, opt_stats_json);
 }
 
+int
+main (int argc, char *argv [])
+{
+  parse_args (argc, argv);
+  if (opt_precompile) {
+    precompile (input_paths [0]);
+    return 0;
+  }
+  if (opt_run)
+    return run_file (input_paths [0]);
+
+  // With a single input, spend the -j budget on its functions instead.
+  if (ninputs == 1)
+    opt_codegen_threads = opt_jobs;
+
+  elapsed = calloc (ninputs, sizeof (double));
+  use_cache = cache_init ();
+
+  double start = now ();
+  run_jobs (ninputs, opt_jobs, compile_job, NULL);
+  double wall = now () - start;
+
+  if (opt_verbose) {
+    double serial = 0;
+    for (int i = 0; i < ninputs; i++)
+      serial += elapsed [i];
+    fprintf (stderr, "dcc: %d file(s), %d job(s): wall %.3f ms, serial %.3f ms (%.2fx)\n",
+             ninputs, opt_jobs, wall * 1e3, serial * 1e3,
+             wall > 0 ? serial / wall : 1.0);
+  }
+
+  if (use_cache || opt_cache_stats)
+    cache_finish (opt_cache_stats);
+  return 0;
+}
@@ -0,0 +1,125 @@
+#include "dcc.h"
+
+// Register promotion (-O).
+//
+// A scalar local whose address is never taken can live in a register
+// instead of a stack slot, so that loop counters and accumulators are
+// no longer loaded and stored on every use. Locals are ranked by how
+// often they are used, with uses inside loops weighing more, and the
+// top ones get a callee-saved register each. Calls preserve those
+// registers, so the function only saves the ones it uses in its
+// prologue and restores them in its epilogue.
+
+char *promote_regs [] = { "rbx", "r12", "r13", "r14", "r15" };
+
+#define NREGS (sizeof (promote_regs) / sizeof (*promote_regs))
+
+// A use inside n nested loops counts LOOP_WEIGHT^n times, up to
+// MAX_WEIGHT.
+#define LOOP_WEIGHT 8
+#define MAX_WEIGHT 32768
+
+typedef struct {
+  Var *var;
+  long weight;
+  bool addr_taken;
+} Candidate;
+
+static _Thread_local Candidate *cands;
+static _Thread_local int ncands;
+
+static Candidate *find_cand (Var *var) {
+  for (int i = 0; i < ncands; i++)
+    if (cands [i].var == var)
+      return &cands [i];
+  return NULL;
+}
+
+static void count_uses (Node *node, long weight) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+  case ND_NULL:
+  case ND_NUM:
+    return;
+  case ND_VAR: {
+    Candidate *c = find_cand (node->var);
+    if (c)
+      c->weight += weight;
+    return;
+  }
+  case ND_ADDR:
+    if (node->lhs->kind == ND_VAR) {
+      Candidate *c = find_cand (node->lhs->var);
+      if (c)
+        c->addr_taken = true;
+      return;
+    }
+    count_uses (node->lhs, weight);
+    return;
+  case ND_IF:
+  case ND_COND:
+    count_uses (node->cond, weight);
+    count_uses (node->then, weight);
+    count_uses (node->els, weight);
+    return;
+  case ND_WHILE:
+  case ND_FOR: {
+    count_uses (node->init, weight);
+    long inner = weight < MAX_WEIGHT ? weight * LOOP_WEIGHT : weight;
+    count_uses (node->cond, inner);
+    count_uses (node->then, inner);
+    count_uses (node->inc, inner);
+    return;
+  }
+  case ND_BLOCK:
+  case ND_STMT_EXPR:
+    for (Node *n = node->body; n; n = n->next)
+      count_uses (n, weight);
+    return;
+  case ND_FUNCALL:
+    for (Node *n = node->args; n; n = n->next)
+      count_uses (n, weight);
+    return;
+  default:
+    count_uses (node->lhs, weight);
+    count_uses (node->rhs, weight);
+  }
+}
+
+// Assigns registers to the locals of fn that can be promoted and sets
+// fn->nsaved to the number of registers it uses. Runs before the
+// stack frame is laid out, which skips promoted locals.
+void promote_locals (Function *fn) {
+  ncands = 0;
+  for (VarList *vl = fn->locals; vl; vl = vl->next)
+    ncands++;
+  cands = calloc (ncands, sizeof (Candidate));
+
+  int n = 0;
+  for (VarList *vl = fn->locals; vl; vl = vl->next)
+    if (vl->var->ty->kind != TY_ARRAY)
+      cands [n++].var = vl->var;
+  ncands = n;
+
+  for (Node *node = fn->node; node; node = node->next)
+    count_uses (node, 1);
+
+  // Pick the heaviest candidates, one register at a time.
+  fn->nsaved = 0;
+  while (fn->nsaved < NREGS) {
+    Candidate *best = NULL;
+    for (int i = 0; i < ncands; i++) {
+      Candidate *c = &cands [i];
+      if (!c->addr_taken && !c->var->reg && c->weight > 0 &&
+          (!best || c->weight > best->weight))
+        best = c;
+    }
+    if (!best)
+      break;
+    best->var->reg = promote_regs [fn->nsaved++];
+  }
+
+  free (cands);
+}
@@ -0,0 +1,178 @@
+#include "dcc.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+// A minimal thread pool. Workers pull job indices from a shared
+// counter until all jobs have been handed out.
+typedef struct {
+  pthread_mutex_t mu;
+  int next;
+  int njobs;
+  JobFn fn;
+  void *arg;
+} JobQueue;
+
+static void *worker (void *p) {
+  JobQueue *q = p;
+
+  for (;;) {
+    pthread_mutex_lock (&q->mu);
+    int idx = q->next++;
+    pthread_mutex_unlock (&q->mu);
+
+    if (idx >= q->njobs)
+      return NULL;
+    q->fn (idx, q->arg);
+  }
+}
+
+// Runs fn (0, arg) ... fn (njobs - 1, arg) on up to nthreads threads
+// and waits for all of them to finish.
+void run_jobs (int njobs, int nthreads, JobFn fn, void *arg) {
+  if (nthreads > njobs)
+    nthreads = njobs;
+
+  if (nthreads <= 1) {
+    for (int i = 0; i < njobs; i++)
+      fn (i, arg);
+    return;
+  }
+
+  JobQueue q = { .next = 0, .njobs = njobs, .fn = fn, .arg = arg };
+  pthread_mutex_init (&q.mu, NULL);
+
+  pthread_t *threads = calloc (nthreads, sizeof (pthread_t));
+  for (int i = 0; i < nthreads; i++)
+    if (pthread_create (&threads [i], NULL, worker, &q))
+      error ("pthread_create: %s", strerror (errno));
+  for (int i = 0; i < nthreads; i++)
+    pthread_join (threads [i], NULL);
+
+  pthread_mutex_destroy (&q.mu);
+  free (threads);
+}
+
+// A bounded single-producer/single-consumer queue. The producer only
+// writes tail and the consumer only writes head, so each side needs
+// nothing but an acquire load of the other's index and a release
+// store of its own. The indices live on separate cache lines so the
+// two threads do not contend for them.
+//
+// Waiting is common: codegen is much faster than the front end, so
+// the consumer finds the queue empty most of the time. A side that
+// has to wait spins briefly, then sleeps on its condition variable.
+// The other side only takes the mutex to wake it up when its waiting
+// flag is set. A sleeping consumer is woken once a batch of items is
+// ready, or by queue_flush (), rather than for every single item,
+// which would cost a context switch per item.
+typedef struct {
+  atomic_bool waiting;
+  pthread_cond_t cond;
+} Waiter;
+
+struct Queue {
+  _Alignas (64) atomic_ulong head;	// Next slot to pop
+  _Alignas (64) atomic_ulong tail;	// Next slot to push
+  _Alignas (64) int cap;		// A power of two
+  void **slots;
+  pthread_mutex_t mu;
+  Waiter producer;	// Waits while the queue is full
+  Waiter consumer;	// Waits while the queue is empty
+};
+
+// Spins before going to sleep, long enough to cover a short stall
+// of the other side.
+#define MAX_SPINS 1000
+
+#define WAKE_BATCH 16
+
+Queue *queue_new (int cap) {
+  Queue *q = aligned_alloc (64, sizeof (Queue));
+  atomic_init (&q->head, 0);
+  atomic_init (&q->tail, 0);
+  q->cap = cap;
+  q->slots = calloc (cap, sizeof (void *));
+  pthread_mutex_init (&q->mu, NULL);
+  atomic_init (&q->producer.waiting, false);
+  atomic_init (&q->consumer.waiting, false);
+  pthread_cond_init (&q->producer.cond, NULL);
+  pthread_cond_init (&q->consumer.cond, NULL);
+  return q;
+}
+
+void queue_free (Queue *q) {
+  pthread_mutex_destroy (&q->mu);
+  pthread_cond_destroy (&q->producer.cond);
+  pthread_cond_destroy (&q->consumer.cond);
+  free (q->slots);
+  free (q);
+}
+
+static bool is_full (Queue *q, unsigned long tail) {
+  return tail - atomic_load_explicit (&q->head, memory_order_acquire) == q->cap;
+}
+
+static bool is_empty (Queue *q, unsigned long head) {
+  return atomic_load_explicit (&q->tail, memory_order_acquire) == head;
+}
+
+// Waits until blocked (q, idx) is false. The waiting flag is set
+// before the last check and the other side checks the flag after
+// publishing its index, with full fences in between, so that at
+// least one of the two sees the other's store and no wakeup is lost.
+static void wait_for (Queue *q, Waiter *w, bool (*blocked) (Queue *, unsigned long),
+                      unsigned long idx) {
+  for (int i = 0; i < MAX_SPINS; i++)
+    if (!blocked (q, idx))
+      return;
+
+  pthread_mutex_lock (&q->mu);
+  atomic_store (&w->waiting, true);
+  atomic_thread_fence (memory_order_seq_cst);
+  while (blocked (q, idx))
+    pthread_cond_wait (&w->cond, &q->mu);
+  atomic_store (&w->waiting, false);
+  pthread_mutex_unlock (&q->mu);
+}
+
+// Wakes up the other side if it is waiting.
+static void wake (Queue *q, Waiter *w) {
+  atomic_thread_fence (memory_order_seq_cst);
+  if (!atomic_load_explicit (&w->waiting, memory_order_relaxed))
+    return;
+  pthread_mutex_lock (&q->mu);
+  pthread_cond_signal (&w->cond);
+  pthread_mutex_unlock (&q->mu);
+}
+
+// Appends item, waiting while the queue is full.
+void queue_push (Queue *q, void *item) {
+  unsigned long tail = atomic_load_explicit (&q->tail, memory_order_relaxed);
+  if (is_full (q, tail))
+    wait_for (q, &q->producer, is_full, tail);
+
+  q->slots [tail & (q->cap - 1)] = item;
+  atomic_store_explicit (&q->tail, tail + 1, memory_order_release);
+
+  unsigned long head = atomic_load_explicit (&q->head, memory_order_relaxed);
+  if (tail + 1 - head >= WAKE_BATCH || tail + 1 - head == q->cap)
+    wake (q, &q->consumer);
+}
+
+// Wakes up the consumer for the items pushed since the last batch.
+// Must be called after the last push.
+void queue_flush (Queue *q) {
+  wake (q, &q->consumer);
+}
+
+// Removes the oldest item, waiting while the queue is empty.
+void *queue_pop (Queue *q) {
+  unsigned long head = atomic_load_explicit (&q->head, memory_order_relaxed);
+  if (is_empty (q, head))
+    wait_for (q, &q->consumer, is_empty, head);
+
+  void *item = q->slots [head & (q->cap - 1)];
+  atomic_store_explicit (&q->head, head + 1, memory_order_release);
+  wake (q, &q->producer);
+  return item;
+}
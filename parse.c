@@ -3,9 +3,40 @@
 
 // All local variable instances created during parsing are
 // accumulated to this list.
-static VarList *locals;
-static VarList *globals;
-static VarList *scope;
+static _Thread_local VarList *locals;
+static _Thread_local VarList *globals;
+static _Thread_local VarList *scope;
+
+// String literals are owned by the function that uses them
+// and labeled per function, so a function's code and data
+// can be reused independently of the rest of the file.
+static _Thread_local VarList *literals;
+static _Thread_local char *funcname;
+static _Thread_local unsigned int labelcnt;
+
+// Nodes, local variables and everything else that belongs to a
+// function body are allocated from an arena, which packs them
+// contiguously in the order the parser creates them. Streaming
+// mode frees it once the function has been emitted.
+static _Thread_local Arena fn_arena;
+static _Thread_local bool in_function;
+
+// The functions defined so far, as Vars holding their return type.
+// A call to any other function is assumed to return int.
+static _Thread_local VarList *functions;
+static _Thread_local HashMap fn_types;
+
+static void *alloc (size_t size) {
+  if (in_function)
+    return arena_alloc (&fn_arena, size);
+  return calloc (1, size);
+}
+
+static char *new_name (Token *tok) {
+  char *name = alloc (tok->len + 1);
+  memcpy (name, tok->str, tok->len);
+  return name;
+}
 
 // find a variable by name.
 static Var *find_var (Token *tok) {
@@ -19,7 +50,8 @@ static Var *find_var (Token *tok) {
 }
 
 static Node *new_node (NodeKind kind, Token *tok) {
-  Node *node = calloc (1, sizeof (Node));
+  Node *node = arena_alloc (&fn_arena, sizeof (Node));
+  stats.nodes++;
   node->kind = kind;
   node->tok  = tok;
   return node;
@@ -29,34 +61,39 @@ static Node *new_binary (NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
   Node *node = new_node (kind, tok);
   node->lhs  = lhs;
   node->rhs  = rhs;
+  set_type (node);
   return node;
 }
 
 static Node *new_unary (NodeKind kind, Node *expr, Token *tok) {
   Node *node = new_node (kind, tok);
   node->lhs  = expr;
+  set_type (node);
   return node;
 }
 
 static Node *new_num (int val, Token *tok) {
   Node *node = new_node (ND_NUM, tok);
   node->val  = val;
+  node->ty   = int_type;
   return node;
 }
 
 static Node *new_var_node (Var *var, Token *tok) {
   Node *node = new_node (ND_VAR, tok);
   node->var = var;
+  node->ty  = var->ty;
   return node;
 }
 
 static Var *new_var (char *name, Type *ty, bool is_local) {
-  Var *var  = calloc (1, sizeof (Var));
+  Var *var  = alloc (sizeof (Var));
+  stats.vars++;
   var->name = name;
   var->ty   = ty;
   var->is_local = is_local;
 
-  VarList *sc = calloc (1, sizeof (VarList));
+  VarList *sc = alloc (sizeof (VarList));
   sc->var  = var;
   sc->next = scope;
   scope    = sc;
@@ -66,7 +103,7 @@ static Var *new_var (char *name, Type *ty, bool is_local) {
 static Var *new_lvar (char *name, Type *ty) {
   Var *var = new_var (name, ty, true);
 
-  VarList *vl = calloc (1, sizeof (VarList));
+  VarList *vl = alloc (sizeof (VarList));
   vl->var = var;
   vl->next = locals;
   locals = vl;
@@ -83,17 +120,19 @@ static Var *new_gvar (char *name, Type *ty) {
   return var;
 }
 
-static char *new_label (void) {
-  static unsigned int cnt = 0;
-  char label [20];
-  sprintf (label, ".L.data.%d", cnt++);
-  return strndup (label, 20);
+static Var *new_literal (Type *ty) {
+  char *label = alloc (strlen (funcname) + 20);
+  sprintf (label, ".L.data.%s.%d", funcname, labelcnt++);
+  Var *var = new_var (label, ty, false);
+
+  VarList *vl = alloc (sizeof (VarList));
+  vl->var = var;
+  vl->next = literals;
+  literals = vl;
+  return var;
 }
 
 static Node *new_add (Node *lhs, Node *rhs, Token *tok) {
-  add_type (lhs);
-  add_type (rhs);
-
   if (is_integer (lhs->ty) && is_integer (rhs->ty))
     return new_binary (ND_ADD, lhs, rhs, tok);
   if (lhs->ty->base && is_integer (rhs->ty))
@@ -106,9 +145,6 @@ static Node *new_add (Node *lhs, Node *rhs, Token *tok) {
 }
 
 static Node *new_sub (Node *lhs, Node *rhs, Token *tok) {
-  add_type (lhs);
-  add_type (rhs);
-
   if (is_integer (lhs->ty) && is_integer (rhs->ty))
     return new_binary (ND_SUB, lhs, rhs, tok);
   if (lhs->ty->base && is_integer (rhs->ty))
@@ -121,7 +157,6 @@ static Node *new_sub (Node *lhs, Node *rhs, Token *tok) {
 }
 
 static Node *new_sizeof (Node *node, Token *tok) {
-  add_type (node);
   return new_num (node->ty->size, tok);
 }
 
@@ -130,9 +165,9 @@ static Type *basetype (void);
 static void global_var (void);
 static Node *declaration (void);
 static Node *stmt (void);
-static Node *stmt2 (void);
 static Node *expr (void);
 static Node *assign (void);
+static Node *conditional (void);
 static Node *equality (void);
 static Node *relational (void);
 static Node *add (void);
@@ -150,19 +185,83 @@ bool is_function (void) {
   return is_func;
 }
 
+// Starts a translation unit with a clean state, or with the
+// globals of the precompiled header.
+void parse_begin (void) {
+  locals = NULL;
+  globals = scope = pch ? pch->globals : NULL;
+
+  free (fn_types.buckets);
+  fn_types = (HashMap) {};
+  functions = pch ? pch->functions : NULL;
+  for (VarList *vl = functions; vl; vl = vl->next)
+    hashmap_put (&fn_types, vl->var->name, vl->var);
+}
+
+// Records the return type of the function defined at the current
+// token, so that calls to it from here on, including recursive ones,
+// get that type. Also done for functions that incremental mode
+// reuses without parsing them.
+static void declare_function (void) {
+  Token *tok = token;
+  Var *fn = calloc (1, sizeof (Var));
+  fn->ty = basetype ();
+  fn->name = new_name (token);
+  token = tok;
+
+  hashmap_put (&fn_types, fn->name, fn);
+  VarList *vl = calloc (1, sizeof (VarList));
+  vl->var = fn;
+  vl->next = functions;
+  functions = vl;
+}
+
+// Parses one top-level item. Returns the function it
+// defines, or NULL for a global variable.
+Function *parse_item (void) {
+  if (!is_function ()) {
+    global_var ();
+    return NULL;
+  }
+
+  declare_function ();
+  Function *fn = opt_incremental ? reuse_function () : NULL;
+  return fn ? fn : function ();
+}
+
+// Frees the last function parsed, including its AST and locals.
+// Only streaming mode calls this; otherwise all functions are
+// kept until codegen.
+void parse_end_function (void) {
+  arena_free (&fn_arena);
+}
+
+// Like parse_end_function (), but hands the memory of the last
+// function over to the caller instead of freeing it.
+void parse_release (Arena *arena) {
+  *arena = fn_arena;
+  fn_arena = (Arena) {};
+}
+
+VarList *parse_globals (void) {
+  return globals;
+}
+
+VarList *parse_functions (void) {
+  return functions;
+}
+
 // program = ( function | global_var )*
 Program *program (void) {
   Program *prog = calloc (1, sizeof (Program));
   Function head = {};
   Function *cur = &head;
 
+  parse_begin ();
   while (!at_eof ()) {
-    if (is_function ()) {
-      cur->next = function ();
-      cur = cur->next;
-    } else {
-      global_var ();
-    }
+    Function *fn = parse_item ();
+    if (fn)
+      cur = cur->next = fn;
   }
 
   prog->globals = globals;
@@ -172,7 +271,7 @@ Program *program (void) {
 
 
 
-// basetype = ( "char" | "int" ) "*"*
+// basetype = ( "char" | "int" | "long" ) "*"*
 static Type *basetype (void) {
   Token *tok;
   Type *ty;
@@ -181,6 +280,8 @@ static Type *basetype (void) {
     ty = char_type;
   else if (tok = consume ("int"))
     ty = int_type;
+  else if (tok = consume ("long"))
+    ty = long_type;
   else
     error_tok (token, "type error");
 
@@ -202,10 +303,11 @@ static Type *read_type_suffix (Type *base) {
 // param = basetype ident type_suffix
 static VarList *read_func_param (void) {
   Type *ty = basetype ();
-  char *name = expect_ident ();
+  char *name = new_name (token);
+  expect_ident ();
   ty = read_type_suffix (ty);
 
-  VarList *vl = calloc (1, sizeof (VarList));
+  VarList *vl = alloc (sizeof (VarList));
   vl->var = new_lvar (name, ty);
   return vl;
 }
@@ -232,10 +334,16 @@ static VarList *read_func_params (void) {
 // param    = basetype ident type_suffix
 static Function *function (void) {
   locals = NULL;
+  literals = NULL;
+  labelcnt = 0;
+  in_function = true;
 
-  Function *fn = calloc (1, sizeof (Function));
+  Function *fn = alloc (sizeof (Function));
+  stats.funcs++;
   fn->ty   = basetype ();
-  fn->name = expect_ident ();
+  fn->tok  = token;
+  fn->name = funcname = new_name (token);
+  expect_ident ();
   expect ("(");
 
   VarList *sc = scope;
@@ -251,8 +359,13 @@ static Function *function (void) {
   }
   scope = sc;	// restore
 
+  for (Node *node = head.next; node; node = node->next)
+    check_types (node);
+
   fn->node = head.next;
   fn->locals = locals;
+  fn->literals = literals;
+  in_function = false;
   return fn;
 }
 
@@ -271,6 +384,7 @@ static void global_var (void) {
   switch (ty->kind) {
   case TY_CHAR:
   case TY_INT:
+  case TY_LONG:
     if (consume ("'"))
       gvar->val = 0;
     else
@@ -282,9 +396,9 @@ static void global_var (void) {
   case TY_ARRAY:
     expect ("{");
     gvar->int_arr = calloc (gvar->ty->array_len, sizeof (int));
-    for (int i = 0; i < gvar->ty->size; i++) {
-      if (consume ("}"))
-        break;
+    for (int i = 0; !consume ("}"); i++) {
+      if (i == gvar->ty->array_len)
+        error_tok (token, "excess elements in array initializer");
       consume (",");
       gvar->int_arr [i] = expect_number ();
     }
@@ -300,7 +414,8 @@ static void global_var (void) {
 static Node *declaration (void) {
   Token *tok = token;
   Type *ty   = basetype ();
-  char *name = expect_ident ();
+  char *name = new_name (token);
+  expect_ident ();
   ty = read_type_suffix (ty);
   Var *var = new_lvar (name, ty);
 
@@ -323,7 +438,7 @@ static Node *read_expr_stmt (void) {
 
 // Returns true if the next token represents a type.
 static bool is_typename (void) {
-  static char *ty[] = {"int", "char"};
+  static char *ty[] = {"int", "char", "long"};
   Token *tok;
 
   for (int i = 0; i < sizeof (ty) / sizeof (*ty); i++) {
@@ -341,12 +456,6 @@ static bool is_typename (void) {
 //      | declaration
 //      | expr ";"
 static Node *stmt (void) {
-  Node *node = stmt2 ();
-  add_type (node);
-  return node;
-}
-
-static Node *stmt2 (void) {
   Node *node;
   Token *tok;
 
@@ -411,15 +520,31 @@ static Node *expr (void) {
   return assign ();
 }
 
-// assign = equality ("=" assign)?
+// assign = conditional ("=" assign)?
 static Node *assign (void) {
-  Node *node = equality ();
+  Node *node = conditional ();
   Token *tok;
   if (tok = consume ("="))
     node = new_binary (ND_ASSIGN, node, assign (), tok);
   return node;
 }
 
+// conditional = equality ("?" expr ":" conditional)?
+static Node *conditional (void) {
+  Node *node = equality ();
+  Token *tok = consume ("?");
+  if (!tok)
+    return node;
+
+  Node *cond = new_node (ND_COND, tok);
+  cond->cond = node;
+  cond->then = expr ();
+  expect (":");
+  cond->els = conditional ();
+  set_type (cond);
+  return cond;
+}
+
 // equality = relational ("==" relational | "!=" relational)*
 static Node *equality (void) {
   Node *node = relational ();
@@ -541,6 +666,7 @@ static Node *stmt_expr (Token *tok) {
     error_tok (cur->tok, "stmt expr returning void is not supported");
   }
   memcpy (cur, cur->lhs, sizeof (Node));
+  set_type (node);
   return node;
 }
 
@@ -580,8 +706,12 @@ static Node *primary (void) {
     // Function call
     if (consume ("(")) {
       node = new_node (ND_FUNCALL, tok);
-      node->funcname = strndup (tok->str, tok->len);
+      node->funcname = new_name (tok);
       node->args = func_args ();
+      Var *fn = hashmap_get2 (&fn_types, tok->str, tok->len);
+      if (fn)
+        node->ty = fn->ty;
+      set_type (node);
       return node;
     }
 
@@ -591,11 +721,10 @@ static Node *primary (void) {
       error_tok (tok, "undeclared variable\n");
     return new_var_node (var, tok);
   } else if (token->kind == TK_STR) {
-    tok = token;
-    token = token->next;
+    tok = token++;
 
     Type *ty = array_of (char_type, tok->cont_len);
-    Var *var = new_gvar (new_label (), ty);
+    Var *var = new_literal (ty);
     var->contents = tok->contents;
     var->cont_len = tok->cont_len;
     return new_var_node (var, tok);
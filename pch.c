@@ -0,0 +1,432 @@
+#include "dcc.h"
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Precompiled headers.
+//
+// "dcc --precompile hdr.h -o hdr.pch" compiles a header on its own
+// and saves what a translation unit gets out of including it: the
+// macros it defines, its global variables, and the return types and
+// code of its functions. "dcc -include-pch hdr.pch foo.c" then starts compiling
+// foo.c in that state instead of reading hdr.h again.
+//
+// The file is mapped into memory and used in place. Names, source
+// text, line tables and string literals are read straight from the
+// mapping; only macros, types and globals are rebuilt as objects,
+// which takes a few pointer fixups each. This is done once per run
+// and shared by all compilations.
+//
+// The file starts with a PchHeader. Everything else is addressed by
+// its byte offset from the start of the file; offset 0 means none.
+// Macro tokens refer to their source file and byte offset in it, so
+// that diagnostics still show the header's lines.
+
+#define PCH_MAGIC "dcc-pch"
+#define PCH_VERSION 3
+
+typedef struct {
+  char magic [8];
+  uint32_t version;
+  uint32_t size;	// Size of the file
+  uint32_t flags;	// Codegen flags
+  uint32_t files, nfiles;	// PchFile []
+  uint32_t tokens, ntokens;	// PchToken []
+  uint32_t macros, nmacros;	// PchMacro []
+  uint32_t types, ntypes;	// PchType []
+  uint32_t globals, nglobals;	// PchGlobal []
+  uint32_t functions, nfunctions;	// PchFunction []
+  uint32_t once, nonce;	// uint32_t [] of names
+  uint32_t file_nos, max_file_no;	// uint32_t [] of names, by number
+  uint32_t text, text_len;
+} PchHeader;
+
+typedef struct {
+  uint32_t name;
+  uint32_t contents;
+  uint32_t line_starts;
+  uint32_t nlines;
+} PchFile;
+
+typedef struct {
+  int32_t kind;
+  int32_t len;
+  int32_t file;		// Index of the source file
+  int32_t offset;	// Of the token in its source file
+  int32_t val;		// val or cont_len
+  uint32_t contents;
+  int32_t file_no;
+  int32_t line_no;
+  int32_t col;
+} PchToken;
+
+typedef struct {
+  uint32_t name;
+  int32_t is_func;
+  int32_t has_paste;
+  int32_t params, nparams;	// Token indices
+  int32_t body;		// Token index; the body ends with TK_EOF
+} PchMacro;
+
+// Types 0 to 2 are char, int and long; others refer to earlier ones.
+typedef struct {
+  int32_t kind;
+  int32_t base;
+  int32_t array_len;
+} PchType;
+
+typedef struct {
+  int64_t int_ptr;
+  uint32_t name;
+  int32_t type;
+  int32_t val;
+  uint32_t int_arr;
+  uint32_t contents;
+  int32_t cont_len;
+} PchGlobal;
+
+typedef struct {
+  uint32_t name;
+  int32_t type;		// Return type
+} PchFunction;
+
+Pch *pch;
+
+//
+// Writer
+//
+
+typedef struct {
+  char *data;
+  size_t len;
+  size_t cap;
+} Buf;
+
+// Appends size bytes at an offset aligned to align and returns it.
+static uint32_t put (Buf *b, void *p, size_t size, int align) {
+  size_t off = (b->len + align - 1) & ~(size_t) (align - 1);
+  if (off + size > b->cap) {
+    b->cap = (off + size) * 2;
+    b->data = realloc (b->data, b->cap);
+  }
+  memset (b->data + b->len, 0, off - b->len);
+  memcpy (b->data + off, p, size);
+  b->len = off + size;
+  if (b->len > UINT32_MAX)
+    error ("precompiled header too large");
+  return off;
+}
+
+static uint32_t put_str (Buf *b, char *s) {
+  return put (b, s, strlen (s) + 1, 1);
+}
+
+typedef struct {
+  Buf buf;
+  File **files;
+  PchFile *pfiles;
+  int nfiles;
+  PchToken *tokens;
+  int ntokens;
+  Type **types;
+  PchType *ptypes;
+  int ntypes;
+} Writer;
+
+static int file_index (Writer *w, File *file) {
+  for (int i = 0; i < w->nfiles; i++)
+    if (w->files [i] == file)
+      return i;
+
+  w->files = realloc (w->files, (w->nfiles + 1) * sizeof (File *));
+  w->pfiles = realloc (w->pfiles, (w->nfiles + 1) * sizeof (PchFile));
+  w->files [w->nfiles] = file;
+  w->pfiles [w->nfiles] = (PchFile) {
+    .name = put_str (&w->buf, file->name),
+    .contents = put_str (&w->buf, file->contents),
+    .line_starts = put (&w->buf, file->line_starts, file->nlines * sizeof (int), 4),
+    .nlines = file->nlines,
+  };
+  return w->nfiles++;
+}
+
+// Saves count tokens and returns the index of the first one.
+static int put_tokens (Writer *w, Token *toks, int count) {
+  int idx = w->ntokens;
+  w->ntokens += count;
+  w->tokens = realloc (w->tokens, w->ntokens * sizeof (PchToken));
+
+  for (int i = 0; i < count; i++) {
+    Token *tok = &toks [i];
+    int file = file_index (w, tok->file);
+    if (tok->str < tok->file->contents ||
+        tok->str + tok->len > tok->file->contents + strlen (tok->file->contents))
+      error_tok (tok, "cannot precompile this token");
+
+    w->tokens [idx + i] = (PchToken) {
+      .kind = tok->kind,
+      .len = tok->len,
+      .file = file,
+      .offset = tok->str - tok->file->contents,
+      .val = tok->val,
+      .contents = tok->kind == TK_STR ? put (&w->buf, tok->contents, tok->cont_len, 1) : 0,
+      .file_no = tok->file_no,
+      .line_no = tok->line_no,
+      .col = tok->col,
+    };
+  }
+  return idx;
+}
+
+static int type_index (Writer *w, Type *ty) {
+  if (ty == char_type)
+    return 0;
+  if (ty == int_type)
+    return 1;
+  if (ty == long_type)
+    return 2;
+
+  // Types are interned, so pointer equality finds duplicates.
+  for (int i = 0; i < w->ntypes; i++)
+    if (w->types [i] == ty)
+      return i + 3;
+
+  int base = type_index (w, ty->base);
+  w->types = realloc (w->types, (w->ntypes + 1) * sizeof (Type *));
+  w->ptypes = realloc (w->ptypes, (w->ntypes + 1) * sizeof (PchType));
+  w->types [w->ntypes] = ty;
+  w->ptypes [w->ntypes] = (PchType) { ty->kind, base, ty->array_len };
+  return w->ntypes++ + 3;
+}
+
+void pch_write (Pch *p, char *path) {
+  Writer w = {};
+  PchHeader h = {};
+  put (&w.buf, &h, sizeof (h), 8);
+
+  memcpy (h.magic, PCH_MAGIC, sizeof (h.magic));
+  h.version = PCH_VERSION;
+  h.flags = put_str (&w.buf, p->flags);
+
+  PchMacro *macros = calloc (p->nmacros, sizeof (PchMacro));
+  for (int i = 0; i < p->nmacros; i++) {
+    Macro *m = p->macros [i];
+    int nbody = 1;
+    while (m->body [nbody - 1].kind != TK_EOF)
+      nbody++;
+
+    macros [i] = (PchMacro) {
+      .name = put_str (&w.buf, m->name),
+      .is_func = m->is_func,
+      .has_paste = m->has_paste,
+      .params = put_tokens (&w, m->params, m->nparams),
+      .nparams = m->nparams,
+      .body = put_tokens (&w, m->body, nbody),
+    };
+  }
+
+  int nglobals = 0;
+  for (VarList *vl = p->globals; vl; vl = vl->next)
+    nglobals++;
+
+  PchGlobal *globals = calloc (nglobals, sizeof (PchGlobal));
+  int i = 0;
+  for (VarList *vl = p->globals; vl; vl = vl->next, i++) {
+    Var *var = vl->var;
+    globals [i] = (PchGlobal) {
+      .int_ptr = (intptr_t) var->int_ptr,
+      .name = put_str (&w.buf, var->name),
+      .type = type_index (&w, var->ty),
+      .val = var->val,
+      .contents = var->contents ? put (&w.buf, var->contents, var->cont_len, 1) : 0,
+      .cont_len = var->cont_len,
+    };
+    if (var->int_arr)
+      globals [i].int_arr = put (&w.buf, var->int_arr, var->ty->array_len * sizeof (int), 4);
+  }
+
+  int nfunctions = 0;
+  for (VarList *vl = p->functions; vl; vl = vl->next)
+    nfunctions++;
+
+  PchFunction *functions = calloc (nfunctions, sizeof (PchFunction));
+  i = 0;
+  for (VarList *vl = p->functions; vl; vl = vl->next, i++)
+    functions [i] = (PchFunction) {
+      .name = put_str (&w.buf, vl->var->name),
+      .type = type_index (&w, vl->var->ty),
+    };
+
+  uint32_t *once = calloc (p->nonce, sizeof (uint32_t));
+  for (i = 0; i < p->nonce; i++)
+    once [i] = put_str (&w.buf, p->once [i]);
+
+  uint32_t *file_nos = calloc (p->nfiles + 1, sizeof (uint32_t));
+  for (i = PCH_FILE_NO; i <= p->nfiles; i++)
+    file_nos [i] = put_str (&w.buf, p->files [i]);
+
+  h.text = put (&w.buf, p->text, p->text_len, 1);
+  h.text_len = p->text_len;
+
+  // The record arrays go last, once nothing adds to them.
+  h.nmacros = p->nmacros;
+  h.macros = put (&w.buf, macros, p->nmacros * sizeof (PchMacro), 8);
+  h.nglobals = nglobals;
+  h.globals = put (&w.buf, globals, nglobals * sizeof (PchGlobal), 8);
+  h.nfunctions = nfunctions;
+  h.functions = put (&w.buf, functions, nfunctions * sizeof (PchFunction), 8);
+  h.nonce = p->nonce;
+  h.once = put (&w.buf, once, p->nonce * sizeof (uint32_t), 4);
+  h.max_file_no = p->nfiles;
+  h.file_nos = put (&w.buf, file_nos, (p->nfiles + 1) * sizeof (uint32_t), 4);
+  h.ntokens = w.ntokens;
+  h.tokens = put (&w.buf, w.tokens, w.ntokens * sizeof (PchToken), 8);
+  h.ntypes = w.ntypes;
+  h.types = put (&w.buf, w.ptypes, w.ntypes * sizeof (PchType), 8);
+  h.nfiles = w.nfiles;
+  h.files = put (&w.buf, w.pfiles, w.nfiles * sizeof (PchFile), 8);
+
+  h.size = w.buf.len;
+  memcpy (w.buf.data, &h, sizeof (h));
+
+  FILE *fp = fopen (path, "w");
+  if (!fp)
+    error ("cannot open output file: %s: %s", path, strerror (errno));
+  if (fwrite (w.buf.data, 1, w.buf.len, fp) != w.buf.len || fclose (fp))
+    error ("%s: write error: %s", path, strerror (errno));
+}
+
+//
+// Loader
+//
+
+void pch_load (char *path) {
+  int fd = open (path, O_RDONLY);
+  if (fd == -1)
+    error ("cannot open %s: %s", path, strerror (errno));
+
+  struct stat st;
+  if (fstat (fd, &st) == -1)
+    error ("%s: fstat: %s", path, strerror (errno));
+  if (st.st_size < sizeof (PchHeader))
+    error ("%s: not a dcc precompiled header", path);
+
+  char *base = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (base == MAP_FAILED)
+    error ("%s: mmap: %s", path, strerror (errno));
+  close (fd);
+
+  PchHeader *h = (PchHeader *) base;
+  if (memcmp (h->magic, PCH_MAGIC, sizeof (h->magic)) || h->version != PCH_VERSION ||
+      h->size != st.st_size)
+    error ("%s: not a dcc precompiled header", path);
+
+  Pch *p = calloc (1, sizeof (Pch));
+  p->flags = base + h->flags;
+  p->hash = 0xcbf29ce484222325UL;
+  fnv1a (&p->hash, base, st.st_size);
+
+  PchFile *pfiles = (PchFile *) (base + h->files);
+  File *files = calloc (h->nfiles, sizeof (File));
+  for (int i = 0; i < h->nfiles; i++)
+    files [i] = (File) {
+      .name = base + pfiles [i].name,
+      .contents = base + pfiles [i].contents,
+      .line_starts = (int *) (base + pfiles [i].line_starts),
+      .nlines = pfiles [i].nlines,
+    };
+
+  PchToken *ptoks = (PchToken *) (base + h->tokens);
+  Token *toks = calloc (h->ntokens, sizeof (Token));
+  for (int i = 0; i < h->ntokens; i++) {
+    PchToken *pt = &ptoks [i];
+    Token *tok = &toks [i];
+    tok->kind = pt->kind;
+    tok->len = pt->len;
+    tok->file = &files [pt->file];
+    tok->str = tok->file->contents + pt->offset;
+    tok->val = pt->val;
+    tok->contents = pt->contents ? base + pt->contents : NULL;
+    tok->file_no = pt->file_no;
+    tok->line_no = pt->line_no;
+    tok->col = pt->col;
+  }
+
+  PchMacro *pmacros = (PchMacro *) (base + h->macros);
+  p->nmacros = h->nmacros;
+  p->macros = calloc (h->nmacros, sizeof (Macro *));
+  for (int i = 0; i < h->nmacros; i++) {
+    Macro *m = calloc (1, sizeof (Macro));
+    m->name = base + pmacros [i].name;
+    m->is_func = pmacros [i].is_func;
+    m->has_paste = pmacros [i].has_paste;
+    m->params = &toks [pmacros [i].params];
+    m->nparams = pmacros [i].nparams;
+    m->body = &toks [pmacros [i].body];
+    p->macros [i] = m;
+  }
+
+  PchType *ptypes = (PchType *) (base + h->types);
+  Type **types = calloc (h->ntypes + 3, sizeof (Type *));
+  types [0] = char_type;
+  types [1] = int_type;
+  types [2] = long_type;
+  for (int i = 0; i < h->ntypes; i++) {
+    Type *b = types [ptypes [i].base];
+    if (ptypes [i].kind == TY_PTR)
+      types [i + 3] = pointer_to (b);
+    else
+      types [i + 3] = array_of (b, ptypes [i].array_len);
+  }
+
+  // Keep the order of the list parse_globals () returned.
+  PchGlobal *pglobals = (PchGlobal *) (base + h->globals);
+  VarList head = {};
+  VarList *cur = &head;
+  for (int i = 0; i < h->nglobals; i++) {
+    PchGlobal *pg = &pglobals [i];
+    Var *var = calloc (1, sizeof (Var));
+    var->name = base + pg->name;
+    var->ty = types [pg->type];
+    var->val = pg->val;
+    var->int_ptr = (int *) (intptr_t) pg->int_ptr;
+    var->int_arr = pg->int_arr ? (int *) (base + pg->int_arr) : NULL;
+    var->contents = pg->contents ? base + pg->contents : NULL;
+    var->cont_len = pg->cont_len;
+
+    cur = cur->next = calloc (1, sizeof (VarList));
+    cur->var = var;
+  }
+  p->globals = head.next;
+
+  PchFunction *pfunctions = (PchFunction *) (base + h->functions);
+  cur = &head;
+  for (int i = 0; i < h->nfunctions; i++) {
+    Var *var = calloc (1, sizeof (Var));
+    var->name = base + pfunctions [i].name;
+    var->ty = types [pfunctions [i].type];
+
+    cur = cur->next = calloc (1, sizeof (VarList));
+    cur->var = var;
+  }
+  p->functions = head.next;
+
+  uint32_t *once = (uint32_t *) (base + h->once);
+  p->nonce = h->nonce;
+  p->once = calloc (h->nonce, sizeof (char *));
+  for (int i = 0; i < h->nonce; i++)
+    p->once [i] = base + once [i];
+
+  uint32_t *file_nos = (uint32_t *) (base + h->file_nos);
+  p->nfiles = h->max_file_no;
+  p->files = calloc (h->max_file_no + 1, sizeof (char *));
+  for (int i = PCH_FILE_NO; i <= h->max_file_no; i++)
+    p->files [i] = base + file_nos [i];
+
+  p->text = base + h->text;
+  p->text_len = h->text_len;
+  free (types);
+  pch = p;
+}
@@ -0,0 +1,972 @@
+#include "dcc.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <unistd.h>
+
+// Preprocessor.
+//
+// Tokens are preprocessed as the tokenizer asks for them, so that
+// streaming mode still reads the input one item at a time. They come
+// from a stack of frames: the main file at the bottom, which is lexed
+// on demand, then included headers and macro expansions. A macro is
+// disabled while its expansion is on the stack. A name that is read
+// while its macro is disabled is marked noexpand for good, which is
+// what stops recursive macros.
+//
+// Headers are lexed once per run and their tokens are shared by all
+// compilations. A header whose contents are wrapped in
+// "#ifndef X ... #endif" is not entered again while X is defined, and
+// one that says "#pragma once" is not entered again at all.
+
+typedef struct {
+  Token *data;
+  int len;
+  int cap;
+} TokenVec;
+
+typedef struct Frame Frame;
+struct Frame {
+  Frame *prev;
+  Token *tok;		// Next token, or NULL for the main file
+  Token *start;		// Expansion to free when the frame is popped
+  Macro *macro;		// Macro being expanded
+  File *file;		// Source file, NULL for expansions
+  short file_no;
+  bool barrier;		// Macro argument, not to be read past its end
+  int nconds;		// Conditional depth when the file was entered
+};
+
+// An #if, #ifdef or #ifndef whose #endif has not been seen yet
+typedef struct {
+  Token tok;
+  bool included;	// A group of it has been included
+  bool in_else;
+} Cond;
+
+// Lexed headers, shared by all threads
+typedef struct {
+  File *file;
+  Token *tokens;
+  char *guard;		// Include guard macro, if any
+  Arena strings;
+} Header;
+
+#define MAX_INCLUDE_DEPTH 200
+
+static char **include_paths;
+static int ninclude_paths;
+
+static HashMap headers;
+static pthread_mutex_t headers_mu = PTHREAD_MUTEX_INITIALIZER;
+
+static _Thread_local Frame *frames;
+static _Thread_local Token lookahead;	// Next token of the main file
+static _Thread_local bool has_lookahead;
+static _Thread_local HashMap macros;
+static _Thread_local HashMap once;	// Files that said #pragma once
+static _Thread_local HashMap file_nos;	// Header path to .loc file number
+static _Thread_local int nfiles;
+static _Thread_local Cond *conds;
+static _Thread_local int nconds;
+static _Thread_local int conds_cap;
+
+// Macro bodies and synthesized tokens live as long as the compilation.
+static _Thread_local Arena macro_arena;
+
+void add_include_path (char *dir) {
+  include_paths = realloc (include_paths, (ninclude_paths + 1) * sizeof (char *));
+  include_paths [ninclude_paths++] = dir;
+}
+
+static void vec_push (TokenVec *v, Token *tok) {
+  if (v->len == v->cap) {
+    v->cap = v->cap ? v->cap * 2 : 16;
+    v->data = realloc (v->data, v->cap * sizeof (Token));
+  }
+  v->data [v->len++] = *tok;
+}
+
+// Terminates v with a TK_EOF token at loc and returns its array.
+static Token *vec_end (TokenVec *v, Token *loc) {
+  Token eof = *loc;
+  eof.kind = TK_EOF;
+  eof.len = 0;
+  vec_push (v, &eof);
+  return v->data;
+}
+
+static bool equal (Token *tok, char *s) {
+  return strlen (s) == tok->len && !strncmp (tok->str, s, tok->len);
+}
+
+static bool is_punct (Token *tok, char *s) {
+  return tok->kind == TK_RESERVED && equal (tok, s);
+}
+
+static Macro *find_macro (Token *tok) {
+  if (!macros.used)
+    return NULL;
+  return hashmap_get2 (&macros, tok->str, tok->len);
+}
+
+//
+// Frames
+//
+
+static Frame *push_frame (void) {
+  Frame *f = calloc (1, sizeof (Frame));
+  f->prev = frames;
+  frames = f;
+  return f;
+}
+
+static void pop_frame (void) {
+  Frame *f = frames;
+  if (f->file && nconds > f->nconds)
+    error_tok (&conds [nconds - 1].tok, "unterminated conditional directive");
+  frames = f->prev;
+  free (f->start);
+  free (f);
+}
+
+// Returns the next token of f without consuming it.
+static Token *frame_peek (Frame *f) {
+  if (f->tok)
+    return f->tok;
+
+  if (!has_lookahead) {
+    lex_next (&lookahead);
+    has_lookahead = true;
+  }
+  return &lookahead;
+}
+
+// Consumes the next token of f. Stays at the end of it.
+static void frame_next (Frame *f, Token *tok) {
+  if (!f->tok) {
+    if (has_lookahead)
+      *tok = lookahead;
+    else
+      lex_next (tok);
+    has_lookahead = false;
+    return;
+  }
+
+  *tok = *f->tok;
+  if (f->tok->kind != TK_EOF)
+    f->tok++;
+  if (f->file)
+    tok->file_no = f->file_no;
+}
+
+// Returns the frame the next token comes from, leaving exhausted
+// frames behind. Neither the main file nor a macro argument is left.
+static Frame *cur_frame (void) {
+  while (frames->prev && !frames->barrier && frame_peek (frames)->kind == TK_EOF)
+    pop_frame ();
+  return frames;
+}
+
+// Reads the rest of the directive line of f.
+static Token *read_line (Frame *f, Token *dir) {
+  TokenVec v = {};
+  Token *loc = dir;
+  while (!frame_peek (f)->at_bol && frame_peek (f)->kind != TK_EOF) {
+    Token tok;
+    frame_next (f, &tok);
+    vec_push (&v, &tok);
+    loc = &v.data [v.len - 1];
+  }
+
+  Token end = *loc;
+  end.str += end.len;
+  end.col += end.len;
+  return vec_end (&v, &end);
+}
+
+//
+// Macro expansion
+//
+
+static bool is_disabled (Macro *m) {
+  for (Frame *f = frames; f; f = f->prev)
+    if (f->macro == m)
+      return true;
+  return false;
+}
+
+static int find_param (Macro *m, Token *tok) {
+  if (tok->kind == TK_IDENT)
+    for (int i = 0; i < m->nparams; i++)
+      if (tok->len == m->params [i].len && !strncmp (tok->str, m->params [i].str, tok->len))
+        return i;
+  return -1;
+}
+
+// Lexes buf, which must hold exactly one token, as a token at loc.
+static Token relex (Token *loc, char *buf) {
+  File *file = new_file (loc->file->name, buf);
+  Token *toks = tokenize_file (file, &macro_arena);
+  if (toks [0].kind == TK_EOF || toks [1].kind != TK_EOF)
+    error_tok (loc, "pasting does not give a valid token");
+
+  Token tok = toks [0];
+  free (toks);
+  tok.file_no = loc->file_no;
+  tok.line_no = loc->line_no;
+  return tok;
+}
+
+// Turns the spelling of arg into a string literal. Tokens are
+// separated by a space wherever the source had white space.
+static Token stringize (Token *hash, Token *arg) {
+  int len = 4;
+  for (Token *t = arg; t->kind != TK_EOF; t++)
+    len += t->len * 2 + 1;
+
+  char *buf = arena_alloc (&macro_arena, len);
+  char *p = buf;
+  *p++ = '"';
+  for (Token *t = arg; t->kind != TK_EOF; t++) {
+    if (t != arg && t->str != t [-1].str + t [-1].len)
+      *p++ = ' ';
+    for (int i = 0; i < t->len; i++) {
+      if (t->str [i] == '"' || t->str [i] == '\\')
+        *p++ = '\\';
+      *p++ = t->str [i];
+    }
+  }
+  strcpy (p, "\"\n");
+  return relex (hash, buf);
+}
+
+static Token paste (Token *lhs, Token *rhs) {
+  char *buf = arena_alloc (&macro_arena, lhs->len + rhs->len + 2);
+  sprintf (buf, "%.*s%.*s\n", lhs->len, lhs->str, rhs->len, rhs->str);
+  return relex (lhs, buf);
+}
+
+static void preprocess_all (TokenVec *v);
+
+// Fully macro-expands toks on their own, as macro arguments are.
+static Token *expand_tokens (Token *toks) {
+  Frame *f = push_frame ();
+  f->tok = toks;
+  f->barrier = true;
+
+  TokenVec v = {};
+  preprocess_all (&v);
+  Token *end = f->tok;
+  pop_frame ();
+  return vec_end (&v, end);
+}
+
+// Substitutes args into the body of m.
+static Token *subst (Macro *m, Token **args, Token *loc) {
+  Token **expanded = calloc (m->nparams, sizeof (Token *));
+  TokenVec v = {};
+  bool placeholder = false;	// Left of "##" is an empty argument
+
+  for (Token *tok = m->body; tok->kind != TK_EOF; tok++) {
+    int i;
+
+    // "#" param
+    if (m->is_func && is_punct (tok, "#") && (i = find_param (m, tok + 1)) >= 0) {
+      Token str = stringize (tok, args [i]);
+      vec_push (&v, &str);
+      tok++;
+      continue;
+    }
+
+    // x "##" y, where an argument next to "##" is not expanded
+    if (is_punct (tok, "##")) {
+      tok++;
+      Token *rhs = tok;
+      Token *end = tok + 1;
+      if ((i = find_param (m, tok)) >= 0) {
+        rhs = args [i];
+        for (end = rhs; end->kind != TK_EOF; end++)
+          ;
+      }
+
+      if (placeholder) {
+        placeholder = false;
+      } else if (rhs != end) {
+        v.data [v.len - 1] = paste (&v.data [v.len - 1], rhs);
+        rhs++;
+      }
+      for (Token *t = rhs; t != end; t++)
+        vec_push (&v, t);
+      continue;
+    }
+
+    if ((i = find_param (m, tok)) >= 0) {
+      Token *arg = args [i];
+      if (is_punct (tok + 1, "##")) {
+        placeholder = arg->kind == TK_EOF;
+      } else {
+        if (!expanded [i])
+          expanded [i] = expand_tokens (args [i]);
+        arg = expanded [i];
+      }
+      for (Token *t = arg; t->kind != TK_EOF; t++)
+        vec_push (&v, t);
+      continue;
+    }
+
+    vec_push (&v, tok);
+  }
+
+  for (int i = 0; i < m->nparams; i++)
+    free (expanded [i]);
+  free (expanded);
+  return vec_end (&v, loc);
+}
+
+// Reads the arguments of a function-like macro call. The name and
+// "(" have been read. The array is terminated by NULL.
+static Token **read_args (Macro *m, Token *name) {
+  Token **args = calloc (m->nparams + 2, sizeof (Token *));
+  int nargs = 0;
+  int depth = 0;
+  TokenVec v = {};
+
+  for (;;) {
+    Token tok;
+    frame_next (cur_frame (), &tok);
+    if (tok.kind == TK_EOF)
+      error_tok (name, "unterminated argument list of macro %s", m->name);
+
+    if (depth == 0 && (is_punct (&tok, ",") || is_punct (&tok, ")"))) {
+      if (nargs == m->nparams && !(nargs == 0 && v.len == 0))
+        error_tok (name, "too many arguments to macro %s", m->name);
+      args [nargs++] = vec_end (&v, &tok);
+      v = (TokenVec) {};
+      if (is_punct (&tok, ")"))
+        break;
+      continue;
+    }
+
+    if (is_punct (&tok, "("))
+      depth++;
+    else if (is_punct (&tok, ")"))
+      depth--;
+    vec_push (&v, &tok);
+  }
+
+  if (nargs < m->nparams)
+    error_tok (name, "too few arguments to macro %s", m->name);
+  return args;
+}
+
+// If tok names a macro, pushes its expansion and returns true.
+static bool expand_macro (Token *tok) {
+  if (tok->noexpand)
+    return false;
+
+  Macro *m = find_macro (tok);
+  if (!m)
+    return false;
+
+  if (is_disabled (m)) {
+    tok->noexpand = true;
+    return false;
+  }
+
+  if (!m->is_func) {
+    Token *body = m->has_paste ? subst (m, NULL, tok) : m->body;
+    Frame *f = push_frame ();
+    f->tok = body;
+    f->start = m->has_paste ? body : NULL;
+    f->macro = m;
+    return true;
+  }
+
+  // The name of a function-like macro alone is not a call.
+  Frame *f = cur_frame ();
+  if (!is_punct (frame_peek (f), "("))
+    return false;
+
+  Token paren;
+  frame_next (f, &paren);
+  Token **args = read_args (m, tok);
+  Token *body = subst (m, args, tok);
+  for (int i = 0; args [i]; i++)
+    free (args [i]);
+  free (args);
+
+  f = push_frame ();
+  f->tok = f->start = body;
+  f->macro = m;
+  return true;
+}
+
+//
+// #if expressions
+//
+
+static _Thread_local Token *ep;
+
+static long eval_cond (void);
+
+static bool eval_consume (char *op) {
+  if (!is_punct (ep, op))
+    return false;
+  ep++;
+  return true;
+}
+
+static long eval_primary (void) {
+  if (eval_consume ("(")) {
+    long val = eval_cond ();
+    if (!eval_consume (")"))
+      error_tok (ep, "expected \")\"");
+    return val;
+  }
+
+  if (ep->kind == TK_NUM)
+    return ep++->val;
+
+  // Names that are left after macro expansion are 0.
+  if (ep->kind != TK_IDENT && !(ep->kind == TK_RESERVED && isalpha (*ep->str)))
+    error_tok (ep, "invalid expression in #if");
+  ep++;
+  return 0;
+}
+
+static long eval_unary (void) {
+  if (eval_consume ("+"))
+    return eval_unary ();
+  if (eval_consume ("-"))
+    return -eval_unary ();
+  if (eval_consume ("!"))
+    return !eval_unary ();
+  if (eval_consume ("~"))
+    return ~eval_unary ();
+  return eval_primary ();
+}
+
+static long eval_mul (void) {
+  long val = eval_unary ();
+  for (;;) {
+    Token *tok = ep;
+    if (eval_consume ("*")) {
+      val *= eval_unary ();
+    } else if (eval_consume ("/") || eval_consume ("%")) {
+      long rhs = eval_unary ();
+      if (rhs == 0)
+        error_tok (tok, "division by zero in #if");
+      val = is_punct (tok, "/") ? val / rhs : val % rhs;
+    } else {
+      return val;
+    }
+  }
+}
+
+static long eval_add (void) {
+  long val = eval_mul ();
+  for (;;) {
+    if (eval_consume ("+"))
+      val += eval_mul ();
+    else if (eval_consume ("-"))
+      val -= eval_mul ();
+    else
+      return val;
+  }
+}
+
+static long eval_shift (void) {
+  long val = eval_add ();
+  for (;;) {
+    if (eval_consume ("<<"))
+      val <<= eval_add ();
+    else if (eval_consume (">>"))
+      val >>= eval_add ();
+    else
+      return val;
+  }
+}
+
+static long eval_relational (void) {
+  long val = eval_shift ();
+  for (;;) {
+    if (eval_consume ("<"))
+      val = val < eval_shift ();
+    else if (eval_consume ("<="))
+      val = val <= eval_shift ();
+    else if (eval_consume (">"))
+      val = val > eval_shift ();
+    else if (eval_consume (">="))
+      val = val >= eval_shift ();
+    else
+      return val;
+  }
+}
+
+static long eval_equality (void) {
+  long val = eval_relational ();
+  for (;;) {
+    if (eval_consume ("=="))
+      val = val == eval_relational ();
+    else if (eval_consume ("!="))
+      val = val != eval_relational ();
+    else
+      return val;
+  }
+}
+
+static long eval_bitand (void) {
+  long val = eval_equality ();
+  while (eval_consume ("&"))
+    val &= eval_equality ();
+  return val;
+}
+
+static long eval_bitxor (void) {
+  long val = eval_bitand ();
+  while (eval_consume ("^"))
+    val ^= eval_bitand ();
+  return val;
+}
+
+static long eval_bitor (void) {
+  long val = eval_bitxor ();
+  while (eval_consume ("|"))
+    val |= eval_bitxor ();
+  return val;
+}
+
+static long eval_logand (void) {
+  long val = eval_bitor ();
+  while (eval_consume ("&&")) {
+    long rhs = eval_bitor ();
+    val = val && rhs;
+  }
+  return val;
+}
+
+static long eval_logor (void) {
+  long val = eval_logand ();
+  while (eval_consume ("||")) {
+    long rhs = eval_logand ();
+    val = val || rhs;
+  }
+  return val;
+}
+
+// cond = logor ( "?" cond ":" cond )?
+static long eval_cond (void) {
+  long val = eval_logor ();
+  if (!eval_consume ("?"))
+    return val;
+
+  long then = eval_cond ();
+  if (!eval_consume (":"))
+    error_tok (ep, "expected \":\"");
+  long els = eval_cond ();
+  return val ? then : els;
+}
+
+// Evaluates the expression of #if or #elif.
+static bool eval_line (Token *dir, Token *line) {
+  // "defined" is resolved before macro expansion.
+  TokenVec v = {};
+  Token *tok = line;
+  for (; tok->kind != TK_EOF; tok++) {
+    if (!equal (tok, "defined")) {
+      vec_push (&v, tok);
+      continue;
+    }
+
+    Token *start = tok++;
+    bool paren = is_punct (tok, "(");
+    if (paren)
+      tok++;
+    if (tok->kind != TK_IDENT)
+      error_tok (tok, "macro name must be an identifier");
+    Token val = *start;
+    val.kind = TK_NUM;
+    val.val = find_macro (tok) != NULL;
+    if (paren && !is_punct (++tok, ")"))
+      error_tok (tok, "expected \")\"");
+    vec_push (&v, &val);
+  }
+  Token *toks = vec_end (&v, tok);
+
+  Token *expanded = expand_tokens (toks);
+  if (expanded->kind == TK_EOF)
+    error_tok (dir, "no expression");
+
+  ep = expanded;
+  long val = eval_cond ();
+  if (ep->kind != TK_EOF)
+    error_tok (ep, "extra token");
+  free (toks);
+  free (expanded);
+  return val;
+}
+
+//
+// Directives
+//
+
+static void push_cond (Token *dir, bool included) {
+  if (nconds == conds_cap) {
+    conds_cap = conds_cap ? conds_cap * 2 : 16;
+    conds = realloc (conds, conds_cap * sizeof (Cond));
+  }
+  conds [nconds++] = (Cond) { *dir, included, false };
+}
+
+// Skips a group that is not included, up to the #elif, #else or
+// #endif that ends it. Returns the name of that directive.
+static Token skip_cond (Frame *f) {
+  int depth = 0;
+  for (;;) {
+    Token tok;
+    frame_next (f, &tok);
+    if (tok.kind == TK_EOF)
+      error_tok (&conds [nconds - 1].tok, "unterminated conditional directive");
+    if (!tok.at_bol || !is_punct (&tok, "#") || frame_peek (f)->at_bol)
+      continue;
+
+    Token *name = frame_peek (f);
+    if (equal (name, "if") || equal (name, "ifdef") || equal (name, "ifndef")) {
+      depth++;
+    } else if (depth > 0) {
+      if (equal (name, "endif"))
+        depth--;
+    } else if (equal (name, "elif") || equal (name, "else") || equal (name, "endif")) {
+      frame_next (f, &tok);
+      return tok;
+    }
+  }
+}
+
+static void define_macro (Token *line) {
+  Token *name = line;
+  if (name->kind != TK_IDENT)
+    error_tok (name, "macro name must be an identifier");
+
+  Macro *m = calloc (1, sizeof (Macro));
+  m->name = strndup (name->str, name->len);
+  Token *tok = name + 1;
+
+  // A "(" right after the name starts a parameter list.
+  if (is_punct (tok, "(") && tok->str == name->str + name->len) {
+    m->is_func = true;
+    TokenVec params = {};
+    if (!is_punct (++tok, ")")) {
+      for (;;) {
+        if (tok->kind != TK_IDENT)
+          error_tok (tok, "expected a parameter name");
+        vec_push (&params, tok++);
+        if (is_punct (tok, ")"))
+          break;
+        if (!is_punct (tok, ","))
+          error_tok (tok, "expected \",\"");
+        tok++;
+      }
+    }
+    tok++;
+    m->params = params.data;
+    m->nparams = params.len;
+  }
+
+  // The body outlives the line, and so do its string literals.
+  TokenVec body = {};
+  for (; tok->kind != TK_EOF; tok++) {
+    Token t = *tok;
+    t.at_bol = false;
+    if (t.kind == TK_STR) {
+      t.contents = arena_alloc (&macro_arena, t.cont_len);
+      memcpy (t.contents, tok->contents, t.cont_len);
+    }
+    if (is_punct (tok, "##")) {
+      if (!body.len || tok [1].kind == TK_EOF)
+        error_tok (tok, "'##' cannot appear at either end of a macro");
+      m->has_paste = true;
+    }
+    vec_push (&body, &t);
+  }
+  m->body = vec_end (&body, tok);
+
+  hashmap_put (&macros, m->name, m);
+}
+
+// Returns a readable path of name, or NULL if there is none.
+static char *find_include (char *name, bool quoted, File *from) {
+  if (name [0] == '/')
+    return access (name, R_OK) ? NULL : name;
+
+  if (quoted) {
+    char *slash = strrchr (from->name, '/');
+    char *path = name;
+    if (slash) {
+      int dirlen = slash - from->name;
+      path = calloc (1, dirlen + strlen (name) + 2);
+      sprintf (path, "%.*s/%s", dirlen, from->name, name);
+    }
+    if (!access (path, R_OK))
+      return path;
+  }
+
+  for (int i = 0; i < ninclude_paths; i++) {
+    char *path = calloc (1, strlen (include_paths [i]) + strlen (name) + 2);
+    sprintf (path, "%s/%s", include_paths [i], name);
+    if (!access (path, R_OK))
+      return path;
+    free (path);
+  }
+  return NULL;
+}
+
+// Returns the guard macro of a header whose contents are wrapped
+// in "#ifndef X ... #endif", or NULL.
+static char *find_guard (Token *tok) {
+  if (!is_punct (tok, "#") || !equal (tok + 1, "ifndef") || tok [2].kind != TK_IDENT)
+    return NULL;
+
+  Token *name = tok + 2;
+  int depth = 0;
+  for (tok = name + 1; tok->kind != TK_EOF; tok++) {
+    if (!tok->at_bol || !is_punct (tok, "#") || tok [1].at_bol)
+      continue;
+    if (equal (tok + 1, "if") || equal (tok + 1, "ifdef") || equal (tok + 1, "ifndef"))
+      depth++;
+    else if (equal (tok + 1, "endif") && depth-- == 0)
+      break;
+  }
+
+  if (tok->kind == TK_EOF)
+    return NULL;
+  for (tok += 2; tok->kind != TK_EOF && !tok->at_bol; tok++)
+    ;
+  return tok->kind == TK_EOF ? strndup (name->str, name->len) : NULL;
+}
+
+static Header *get_header (char *path) {
+  pthread_mutex_lock (&headers_mu);
+  Header *h = hashmap_get (&headers, path);
+  pthread_mutex_unlock (&headers_mu);
+  if (h)
+    return h;
+
+  h = calloc (1, sizeof (Header));
+  h->file = new_file (path, read_file (path));
+  h->tokens = tokenize_file (h->file, &h->strings);
+  h->guard = find_guard (h->tokens);
+
+  // Another thread may have lexed the header in the meantime.
+  pthread_mutex_lock (&headers_mu);
+  Header *h2 = hashmap_get (&headers, path);
+  if (!h2)
+    hashmap_put (&headers, h->file->name, h);
+  pthread_mutex_unlock (&headers_mu);
+  return h2 ? h2 : h;
+}
+
+static int file_no (char *path) {
+  int n = (intptr_t) hashmap_get (&file_nos, path);
+  if (!n) {
+    n = ++nfiles;
+    hashmap_put (&file_nos, path, (void *) (intptr_t) n);
+  }
+  return n;
+}
+
+static void include_file (Frame *f, Token *dir, Token *line) {
+  char *name;
+  bool quoted = line->kind == TK_STR;
+  Token *tok = line + 1;
+
+  if (quoted) {
+    name = strdup (line->contents);
+  } else if (is_punct (line, "<")) {
+    while (tok->kind != TK_EOF && !is_punct (tok, ">"))
+      tok++;
+    if (tok->kind == TK_EOF)
+      error_tok (line, "expected \">\"");
+    name = strndup (line [1].str, tok->str - line [1].str);
+    tok++;
+  } else {
+    error_tok (line, "expected a file name");
+  }
+  if (tok->kind != TK_EOF)
+    error_tok (tok, "extra token");
+
+  char *path = find_include (name, quoted, f->file);
+  if (!path)
+    error_tok (line, "cannot open include file %s", name);
+
+  int depth = 0;
+  for (Frame *fr = frames; fr; fr = fr->prev)
+    depth += fr->file != NULL;
+  if (depth > MAX_INCLUDE_DEPTH)
+    error_tok (dir, "#include nested too deeply");
+
+  Header *h = get_header (path);
+  if (hashmap_get (&once, h->file->name))
+    return;
+  if (h->guard && hashmap_get (&macros, h->guard))
+    return;
+
+  Frame *hf = push_frame ();
+  hf->tok = h->tokens;
+  hf->file = h->file;
+  hf->file_no = file_no (h->file->name);
+  hf->nconds = nconds;
+}
+
+// Runs the directive that starts with the "#" just read from f.
+static void directive (Frame *f) {
+  Token *next = frame_peek (f);
+  if (next->at_bol || next->kind == TK_EOF)
+    return;	// Null directive
+
+  Token dir;
+  frame_next (f, &dir);
+
+  for (;;) {
+    Token *line = read_line (f, &dir);
+    bool skip = false;
+
+    if (equal (&dir, "include")) {
+      include_file (f, &dir, line);
+    } else if (equal (&dir, "define")) {
+      define_macro (line);
+    } else if (equal (&dir, "undef")) {
+      if (line->kind != TK_IDENT)
+        error_tok (line, "macro name must be an identifier");
+      if (find_macro (line))
+        hashmap_put2 (&macros, line->str, line->len, NULL);
+    } else if (equal (&dir, "ifdef") || equal (&dir, "ifndef")) {
+      if (line->kind != TK_IDENT)
+        error_tok (line, "macro name must be an identifier");
+      bool included = (find_macro (line) != NULL) == equal (&dir, "ifdef");
+      push_cond (&dir, included);
+      skip = !included;
+    } else if (equal (&dir, "if")) {
+      bool included = eval_line (&dir, line);
+      push_cond (&dir, included);
+      skip = !included;
+    } else if (equal (&dir, "elif")) {
+      if (nconds == f->nconds || conds [nconds - 1].in_else)
+        error_tok (&dir, "stray #elif");
+      Cond *c = &conds [nconds - 1];
+      skip = c->included || !eval_line (&dir, line);
+      c->included |= !skip;
+    } else if (equal (&dir, "else")) {
+      if (nconds == f->nconds || conds [nconds - 1].in_else)
+        error_tok (&dir, "stray #else");
+      Cond *c = &conds [nconds - 1];
+      c->in_else = true;
+      skip = c->included;
+      c->included = true;
+    } else if (equal (&dir, "endif")) {
+      if (nconds == f->nconds)
+        error_tok (&dir, "stray #endif");
+      nconds--;
+    } else if (equal (&dir, "pragma")) {
+      // Other pragmas are ignored.
+      if (equal (line, "once"))
+        hashmap_put (&once, f->file->name, (void *) 1);
+    } else if (equal (&dir, "error")) {
+      error_tok (&dir, "#error");
+    } else {
+      error_tok (&dir, "invalid preprocessor directive");
+    }
+
+    free (line);
+    if (!skip)
+      return;
+    dir = skip_cond (f);
+  }
+}
+
+//
+// Entry points
+//
+
+// Reads tokens from the current frame until its end into v.
+static void preprocess_all (TokenVec *v) {
+  for (;;) {
+    Token tok;
+    preprocess_next (&tok);
+    if (tok.kind == TK_EOF)
+      return;
+    vec_push (v, &tok);
+  }
+}
+
+// Starts preprocessing of the main file, whose tokens come from
+// lex_next (). With -include-pch, it starts where the precompiled
+// header left off.
+void preprocess_begin (File *file, short file_no) {
+  frames = NULL;
+  Frame *f = push_frame ();
+  f->file = file;
+  f->file_no = file_no;
+  has_lookahead = false;
+
+  macros = (HashMap) {};
+  once = (HashMap) {};
+  file_nos = (HashMap) {};
+  nfiles = file_no;
+  nconds = 0;
+
+  if (!pch)
+    return;
+  for (int i = 0; i < pch->nmacros; i++)
+    hashmap_put (&macros, pch->macros [i]->name, pch->macros [i]);
+  for (int i = 0; i < pch->nonce; i++)
+    hashmap_put (&once, pch->once [i], (void *) 1);
+  for (int i = PCH_FILE_NO; i <= pch->nfiles; i++)
+    hashmap_put (&file_nos, pch->files [i], (void *) (intptr_t) i);
+  nfiles = pch->nfiles;
+}
+
+// Saves the macros, #pragma once headers and file numbers of the
+// main file, which is a header being precompiled.
+void preprocess_export (Pch *p) {
+  p->macros = calloc (macros.used, sizeof (Macro *));
+  for (int i = 0; i < macros.capacity; i++)
+    if (macros.buckets [i].key && macros.buckets [i].val)
+      p->macros [p->nmacros++] = macros.buckets [i].val;
+
+  p->once = calloc (once.used, sizeof (char *));
+  for (int i = 0; i < once.capacity; i++)
+    if (once.buckets [i].key)
+      p->once [p->nonce++] = once.buckets [i].key;
+
+  p->nfiles = nfiles;
+  p->files = calloc (nfiles + 1, sizeof (char *));
+  p->files [PCH_FILE_NO] = filename;
+  for (int i = 0; i < file_nos.capacity; i++)
+    if (file_nos.buckets [i].key)
+      p->files [(intptr_t) file_nos.buckets [i].val] = file_nos.buckets [i].key;
+}
+
+// Reads the next token after preprocessing into tok. At the end of
+// the main file, tok becomes TK_EOF.
+void preprocess_next (Token *tok) {
+  for (;;) {
+    Frame *f = cur_frame ();
+    frame_next (f, tok);
+
+    if (tok->kind == TK_EOF) {
+      if (!f->prev && nconds)
+        error_tok (&conds [nconds - 1].tok, "unterminated conditional directive");
+      return;
+    }
+
+    if (f->file && tok->at_bol && is_punct (tok, "#")) {
+      directive (f);
+      continue;
+    }
+
+    if (tok->kind == TK_IDENT && expand_macro (tok))
+      continue;
+    return;
+  }
+}
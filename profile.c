@@ -0,0 +1,104 @@
+#include "dcc.h"
+
+// Profile-guided optimization.
+//
+// With -fprofile-generate, every function gets an array of 64-bit
+// counters in .data. Counter 0 counts calls of the function, every
+// if, while and for statement gets two counters and every call site
+// gets one, numbered in the order codegen visits them. A descriptor
+// of each array is placed in the "dcc_prof" section, where the
+// runtime (runtime/profile.c) finds it and writes the counts at exit.
+//
+// With -fprofile-use, the profile is read back and codegen uses the
+// counts to pick the block layout.
+//
+// The profile is a text file:
+//
+//   dcc-profile 1
+//   <function> <ncounters> <count>...
+
+typedef struct {
+  int ncounters;
+  long *counts;
+} FnProfile;
+
+static HashMap profile;
+
+// Number of counters a function body needs, excluding the entry counter.
+// Must agree with the sites codegen allocates.
+static int count_sites (Node *node) {
+  if (!node)
+    return 0;
+
+  int n = 0;
+  switch (node->kind) {
+  case ND_NULL:
+  case ND_NUM:
+  case ND_VAR:
+    return 0;
+  case ND_IF:
+  case ND_WHILE:
+  case ND_FOR:
+    return 2 + count_sites (node->cond) + count_sites (node->then) +
+           count_sites (node->els) + count_sites (node->inc);	// els or init
+  case ND_COND:
+    return count_sites (node->cond) + count_sites (node->then) + count_sites (node->els);
+  case ND_BLOCK:
+  case ND_STMT_EXPR:
+    for (Node *n2 = node->body; n2; n2 = n2->next)
+      n += count_sites (n2);
+    return n;
+  case ND_FUNCALL:
+    n = 1;
+    for (Node *n2 = node->args; n2; n2 = n2->next)
+      n += count_sites (n2);
+    return n;
+  default:
+    return count_sites (node->lhs) + count_sites (node->rhs);
+  }
+}
+
+int profile_ncounters (Function *fn) {
+  int n = 1;
+  for (Node *node = fn->node; node; node = node->next)
+    n += count_sites (node);
+  return n;
+}
+
+void profile_load (char *path) {
+  FILE *fp = fopen (path, "r");
+  if (!fp)
+    error ("cannot open profile %s: %s", path, strerror (errno));
+
+  int version;
+  if (fscanf (fp, "dcc-profile %d", &version) != 1 || version != 1)
+    error ("%s: not a dcc profile", path);
+
+  char name [256];
+  int n;
+  while (fscanf (fp, "%255s %d", name, &n) == 2) {
+    FnProfile *prof = calloc (1, sizeof (FnProfile));
+    prof->ncounters = n;
+    prof->counts = calloc (n, sizeof (long));
+    for (int i = 0; i < n; i++)
+      if (fscanf (fp, "%ld", &prof->counts [i]) != 1)
+        error ("%s: truncated profile for %s", path, name);
+    hashmap_put (&profile, strdup (name), prof);
+  }
+  fclose (fp);
+}
+
+// Returns the counts recorded for fn, or NULL if there are none or
+// the function has changed since the profile was taken.
+long *profile_counts (Function *fn) {
+  FnProfile *prof = hashmap_get (&profile, fn->name);
+  if (!prof)
+    return NULL;
+
+  if (prof->ncounters != profile_ncounters (fn)) {
+    fprintf (stderr, "dcc: warning: %s: profile does not match the function, ignored\n",
+             fn->name);
+    return NULL;
+  }
+  return prof->counts;
+}
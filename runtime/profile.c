@@ -0,0 +1,113 @@
+// Profile runtime for programs built with dcc -fprofile-generate.
+// Link it into the instrumented program:
+//
+//   dcc -fprofile-generate foo.c > foo.s
+//   gcc -static -o foo foo.s runtime/profile.c
+//
+// At exit, the counters of every instrumented function are added to
+// the profile in $DCC_PROFILE (default "dcc.prof"), so that several
+// training runs accumulate into one profile.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// One descriptor per function, emitted by dcc into the "dcc_prof"
+// section. The linker defines the bounds of the section.
+typedef struct {
+  char *name;
+  long *counters;
+  long ncounters;
+} ProfDesc;
+
+extern ProfDesc __start_dcc_prof [] __attribute__ ((weak));
+extern ProfDesc __stop_dcc_prof [] __attribute__ ((weak));
+
+typedef struct Entry Entry;
+struct Entry {
+  Entry *next;
+  char *name;
+  long n;
+  long *counts;
+};
+
+// Reads an existing profile. Returns NULL if there is none.
+static Entry *read_profile (char *path) {
+  FILE *fp = fopen (path, "r");
+  if (!fp)
+    return NULL;
+
+  Entry head = {};
+  Entry *cur = &head;
+  int version;
+  char name [256];
+  long n;
+
+  if (fscanf (fp, "dcc-profile %d", &version) == 1 && version == 1) {
+    while (fscanf (fp, "%255s %ld", name, &n) == 2) {
+      Entry *e = calloc (1, sizeof (Entry));
+      e->name = strdup (name);
+      e->n = n;
+      e->counts = calloc (n, sizeof (long));
+      for (long i = 0; i < n; i++)
+        fscanf (fp, "%ld", &e->counts [i]);
+      cur = cur->next = e;
+    }
+  }
+
+  fclose (fp);
+  return head.next;
+}
+
+static Entry *find (Entry *list, char *name) {
+  for (Entry *e = list; e; e = e->next)
+    if (!strcmp (e->name, name))
+      return e;
+  return NULL;
+}
+
+__attribute__ ((destructor))
+static void dcc_profile_dump (void) {
+  if (__start_dcc_prof == __stop_dcc_prof)
+    return;
+
+  char *path = getenv ("DCC_PROFILE");
+  if (!path || !*path)
+    path = "dcc.prof";
+
+  Entry *list = read_profile (path);
+
+  for (ProfDesc *d = __start_dcc_prof; d < __stop_dcc_prof; d++) {
+    Entry *e = find (list, d->name);
+    if (e && e->n == d->ncounters) {
+      for (long i = 0; i < e->n; i++)
+        e->counts [i] += d->counters [i];
+      continue;
+    }
+
+    // New function, or one that changed since the last run
+    if (!e) {
+      e = calloc (1, sizeof (Entry));
+      e->name = d->name;
+      e->next = list;
+      list = e;
+    }
+    e->n = d->ncounters;
+    e->counts = d->counters;
+  }
+
+  FILE *fp = fopen (path, "w");
+  if (!fp) {
+    perror (path);
+    return;
+  }
+
+  fprintf (fp, "dcc-profile 1\n");
+  for (Entry *e = list; e; e = e->next) {
+    fprintf (fp, "%s %ld", e->name, e->n);
+    for (long i = 0; i < e->n; i++)
+      fprintf (fp, " %ld", e->counts [i]);
+    fprintf (fp, "\n");
+  }
+  fclose (fp);
+}
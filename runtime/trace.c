@@ -0,0 +1,151 @@
+// Trace runtime for programs built with dcc -finstrument-functions.
+// Link it into the instrumented program:
+//
+//   dcc -finstrument-functions=rdtsc foo.c > foo.s
+//   gcc -static -pthread -o foo foo.s runtime/trace.c
+//
+// Function entries and exits are recorded in a per-thread ring buffer,
+// either inline by the generated code (=rdtsc) or by the
+// __cyg_profile_func_enter/exit hooks below. At exit, the events are
+// written as Chrome trace JSON to $DCC_TRACE (default
+// "dcc-trace.json"), which chrome://tracing and Perfetto can open.
+// Threads other than the main one call __dcc_trace_flush () before
+// they exit to keep their events.
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define NOINSTR __attribute__ ((no_instrument_function))
+
+// Must match TRACE_RING_SIZE in dcc.h. The generated code addresses
+// the ring directly, so the layout of Ring must not change either.
+#define RING_SIZE 65536
+
+typedef struct {
+  unsigned long tsc;	// Timestamp << 1 | is_exit
+  void *fn;
+} Event;
+
+typedef struct {
+  unsigned long head;	// Total number of events recorded
+  Event ev [RING_SIZE];
+} Ring;
+
+__thread Ring __dcc_trace;
+
+// Address to name table, emitted by dcc into the "dcc_syms" section
+typedef struct {
+  void *addr;
+  char *name;
+} Sym;
+
+extern Sym __start_dcc_syms [] __attribute__ ((weak));
+extern Sym __stop_dcc_syms [] __attribute__ ((weak));
+
+static pthread_mutex_t mu = PTHREAD_MUTEX_INITIALIZER;
+static char *json;
+static size_t json_len;
+static FILE *json_out;
+
+// Reference points for converting timestamps to microseconds
+static unsigned long start_tsc;
+static double start_sec;
+
+static NOINSTR unsigned long rdtsc (void) {
+  unsigned int lo, hi;
+  __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+  return (unsigned long) hi << 32 | lo;
+}
+
+static NOINSTR double now (void) {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static NOINSTR void record (void *fn, int is_exit) {
+  Ring *r = &__dcc_trace;
+  Event *e = &r->ev [r->head++ & (RING_SIZE - 1)];
+  e->tsc = rdtsc () << 1 | is_exit;
+  e->fn = fn;
+}
+
+NOINSTR void __cyg_profile_func_enter (void *fn, void *call_site) {
+  record (fn, 0);
+}
+
+NOINSTR void __cyg_profile_func_exit (void *fn, void *call_site) {
+  record (fn, 1);
+}
+
+static NOINSTR char *sym_name (void *addr) {
+  for (Sym *s = __start_dcc_syms; s < __stop_dcc_syms; s++)
+    if (s->addr == addr)
+      return s->name;
+  return NULL;
+}
+
+// Moves the calling thread's events into the trace.
+NOINSTR void __dcc_trace_flush (void) {
+  Ring *r = &__dcc_trace;
+  unsigned long end = r->head;
+  unsigned long begin = end > RING_SIZE ? end - RING_SIZE : 0;
+  long tid = syscall (SYS_gettid);
+
+  double ticks_per_us = (rdtsc () - start_tsc) / ((now () - start_sec) * 1e6);
+  if (ticks_per_us <= 0)
+    ticks_per_us = 1;
+
+  pthread_mutex_lock (&mu);
+  if (!json_out)
+    json_out = open_memstream (&json, &json_len);
+
+  for (unsigned long i = begin; i < end; i++) {
+    Event *e = &r->ev [i & (RING_SIZE - 1)];
+    double ts = ((long) ((e->tsc >> 1) - start_tsc)) / ticks_per_us;
+    char *name = sym_name (e->fn);
+
+    fprintf (json_out, "%s{\"ph\":\"%c\",\"pid\":%d,\"tid\":%ld,\"ts\":%.3f,\"name\":",
+             json_len ? ",\n" : "", (e->tsc & 1) ? 'E' : 'B', getpid (), tid, ts);
+    if (name)
+      fprintf (json_out, "\"%s\"}", name);
+    else
+      fprintf (json_out, "\"%p\"}", e->fn);
+    fflush (json_out);
+  }
+  r->head = 0;
+  pthread_mutex_unlock (&mu);
+}
+
+__attribute__ ((constructor))
+static NOINSTR void dcc_trace_start (void) {
+  start_sec = now ();
+  start_tsc = rdtsc ();
+}
+
+__attribute__ ((destructor))
+static NOINSTR void dcc_trace_dump (void) {
+  __dcc_trace_flush ();
+
+  char *path = getenv ("DCC_TRACE");
+  if (!path || !*path)
+    path = "dcc-trace.json";
+
+  FILE *fp = fopen (path, "w");
+  if (!fp) {
+    perror (path);
+    return;
+  }
+
+  fclose (json_out);
+  fprintf (fp, "{\"traceEvents\":[\n");
+  fwrite (json, 1, json_len, fp);
+  fprintf (fp, "\n]}\n");
+  fclose (fp);
+}
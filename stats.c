@@ -0,0 +1,81 @@
+#include "dcc.h"
+#include <sys/resource.h>
+#include <time.h>
+
+// Per-compilation timers and counters for -ftime-report and -fstats.
+// Each translation unit is compiled by a single thread, so the
+// counters are thread-local and need no synchronization.
+
+_Thread_local Stats stats;
+
+static char *phase_names [] = {
+  "read_file", "tokenize", "parse", "layout", "codegen",
+};
+
+double now (void) {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Peak resident set size of the whole process in KiB
+static long peak_rss (void) {
+  struct rusage ru;
+  getrusage (RUSAGE_SELF, &ru);
+  return ru.ru_maxrss;
+}
+
+static void print_table (FILE *out, char *path) {
+  double total = 0;
+  for (int i = 0; i < NUM_PHASES; i++)
+    total += stats.time [i];
+
+  fprintf (out, "dcc: %s\n", path);
+  fprintf (out, "  %-12s %12s %7s\n", "phase", "time (ms)", "%");
+  for (int i = 0; i < NUM_PHASES; i++)
+    fprintf (out, "  %-12s %12.3f %6.1f%%\n", phase_names [i], stats.time [i] * 1e3,
+             total > 0 ? 100 * stats.time [i] / total : 0.0);
+  fprintf (out, "  %-12s %12.3f\n", "total", total * 1e3);
+
+  fprintf (out, "  %-12s %12ld\n", "tokens", stats.tokens);
+  fprintf (out, "  %-12s %12ld (%ld bytes)\n", "nodes", stats.nodes, stats.nodes * (long) sizeof (Node));
+  fprintf (out, "  %-12s %12ld\n", "types", stats.types);
+  fprintf (out, "  %-12s %12ld\n", "variables", stats.vars);
+  fprintf (out, "  %-12s %12ld\n", "functions", stats.funcs);
+  fprintf (out, "  %-12s %12ld\n", "instructions", stats.insns);
+  fprintf (out, "  %-12s %12ld KiB\n", "peak RSS", peak_rss ());
+}
+
+// One JSON object per line, so that reports of several
+// translation units can simply be concatenated.
+static void print_json (FILE *out, char *path) {
+  fprintf (out, "{\"file\":\"");
+  for (char *p = path; *p; p++) {
+    if (*p == '"' || *p == '\\')
+      fputc ('\\', out);
+    fputc (*p, out);
+  }
+  fprintf (out, "\",\"time_ms\":{");
+  for (int i = 0; i < NUM_PHASES; i++)
+    fprintf (out, "%s\"%s\":%.3f", i ? "," : "", phase_names [i], stats.time [i] * 1e3);
+  fprintf (out, "},\"tokens\":%ld,\"nodes\":%ld,\"node_bytes\":%ld,\"types\":%ld,"
+           "\"variables\":%ld,\"functions\":%ld,\"instructions\":%ld,\"peak_rss_kib\":%ld}\n",
+           stats.tokens, stats.nodes, stats.nodes * (long) sizeof (Node), stats.types,
+           stats.vars, stats.funcs, stats.insns, peak_rss ());
+}
+
+void print_stats (char *path, bool json) {
+  // Format into a buffer first, so that reports from
+  // concurrent compilations do not interleave.
+  char *buf;
+  size_t len;
+  FILE *out = open_memstream (&buf, &len);
+  if (json)
+    print_json (out, path);
+  else
+    print_table (out, path);
+  fclose (out);
+
+  fwrite (buf, 1, len, stderr);
+  free (buf);
+}
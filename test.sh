@@ -1,23 +1,75 @@
 #!/bin/bash
-
-cat <<EOF | gcc -xc -c -o tmp2.o -
+#
+# Each assert line is a complete program and the expected exit status
+# of its main (). By default all snippets are compiled as one batch:
+# every snippet's declared names get a "_<case>" suffix so that they
+# can share a translation unit, dcc and gcc run once, and a generated
+# driver calls each renamed main and reports per-case results. The
+# batch is then run a second time in-process with --run, which must
+# report the same results.
+#
+# ./test.sh --serial runs the old compile, link and execute cycle once
+# per snippet, which helps to isolate a snippet that crashes. Any
+# other arguments are passed to dcc, e.g. ./test.sh -O.
+#
+# Generated files go to a scratch directory that is removed on exit.
+
+HELPERS='
 int ret3 () { return 3; }
 int ret5 () { return 5; }
 int add (int x, int y) { return x + y; }
 int sub (int x, int y) { return x - y; }
+int neg1 () { return -1; }
 
 int add6 (int a, int b, int c, int d, int e, int f) {
   return a+b+c+d+e+f;
 }
-EOF
+'
+
+tmpdir=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmpdir"' EXIT
+
+serial=0
+if [ "$1" = "--serial" ]; then
+  serial=1
+  shift
+  echo "$HELPERS" | gcc -xc -c -o $tmpdir/helpers.o -
+fi
+DCCFLAGS="$*"
+
+cases=0
+expected=()
+inputs=()
 
 assert () {
+  if [ $serial = 1 ]; then
+    assert_serial "$@"
+    return
+  fi
+
+  expected[$cases]="$1"
+  inputs[$cases]="$2"
+  cases=$((cases + 1))
+}
+
+# Snippets that reach a neighbouring local through a pointer rely on
+# the stack layout of locals. -O keeps locals in registers instead,
+# so these only run without it.
+assert_layout () {
+  case " $DCCFLAGS " in
+  *" -O "*) ;;
+  *) assert "$@" ;;
+  esac
+}
+
+assert_serial () {
   expected="$1"
   input="$2"
 
-  ./dcc "$input" > tmp.s
-  gcc -static -o tmp tmp.s tmp2.o
-  ./tmp
+  echo "$input" > $tmpdir/tmp.c
+  ./dcc $DCCFLAGS $tmpdir/tmp.c > $tmpdir/tmp.s
+  gcc -static -o $tmpdir/tmp $tmpdir/tmp.s $tmpdir/helpers.o
+  $tmpdir/tmp
   actual="$?"
 
   if [ "$actual" = "$expected" ]; then
@@ -28,14 +80,82 @@ assert () {
   fi
 }
 
-assert_link () {
-  expected="$1"
-  input="$2"
-  linked="$3"
+# Appends "_<n>" to every name the snippet declares. This is done
+# with macros, which leave string literals and character constants
+# alone.
+rename () {
+  local src="$1"
+  local n="$2"
+  local names=$(echo "$src" | grep -oE '\<(int|char|long)[ *]+[A-Za-z_][A-Za-z0-9_]*' |
+                sed -E 's/^(int|char|long)[ *]+//' | sort -u)
+  for name in $names; do
+    echo "#define $name ${name}_$n"
+  done
+  echo "$src"
+  for name in $names; do
+    echo "#undef $name"
+  done
+}
+
+c_string () {
+  echo "$1" | sed -e 's/\\/\\\\/g' -e 's/"/\\"/g'
+}
+
+# The driver is written in the subset of C that dcc accepts, so that
+# the --run pass can compile it along with the snippets. Exit statuses
+# are 8 bits wide; dcc has no "&", so the result is reduced by hand.
+driver () {
+  echo 'int failed;'
+  echo 'int check (int expected, int actual, char *input) {'
+  echo '  actual = actual - actual / 256 * 256;'
+  echo '  if (actual < 0) actual = actual + 256;'
+  echo '  if (actual == expected) {'
+  echo '    printf ("%s => %d\n", input, actual);'
+  echo '  } else {'
+  echo '    printf ("%s => %d expected, but got %d\n", input, expected, actual);'
+  echo '    failed = 1;'
+  echo '  }'
+  echo '  return 0;'
+  echo '}'
+  echo 'int main () {'
+  for ((i = 0; i < cases; i++)); do
+    echo "  check (${expected[$i]}, main_$i (), \"$(c_string "${inputs[$i]}")\");"
+  done
+  echo '  return failed;'
+  echo '}'
+}
 
-  ./dcc "$input" > tmp.s
-  cc -o tmp tmp.s "$linked"
-  ./tmp
+# Runs the batch twice: assembled and linked by gcc, with gcc-compiled
+# helpers and driver, and in-process with --run, where dcc compiles
+# everything itself.
+run_batch () {
+  : > $tmpdir/batch.c
+  for ((i = 0; i < cases; i++)); do
+    rename "${inputs[$i]}" $i >> $tmpdir/batch.c
+  done
+
+  {
+    echo '#include <stdio.h>'
+    echo "$HELPERS"
+    for ((i = 0; i < cases; i++)); do
+      echo "int main_$i (void);"
+    done
+    driver
+  } > $tmpdir/driver.c
+
+  ./dcc $DCCFLAGS $tmpdir/batch.c > $tmpdir/batch.s || exit 1
+  gcc -static -o $tmpdir/batch $tmpdir/batch.s $tmpdir/driver.c || exit 1
+  $tmpdir/batch > $tmpdir/batch.out || { cat $tmpdir/batch.out; exit 1; }
+
+  {
+    echo "$HELPERS"
+    cat $tmpdir/batch.c
+    driver
+  } > $tmpdir/run.c
+
+  ./dcc $DCCFLAGS --run $tmpdir/run.c > $tmpdir/run.out || { cat $tmpdir/run.out; exit 1; }
+  cmp -s $tmpdir/batch.out $tmpdir/run.out || { diff $tmpdir/batch.out $tmpdir/run.out; exit 1; }
+  cat $tmpdir/batch.out
 }
 
 assert 0 'int main() { return 0; }'
@@ -95,6 +215,12 @@ assert 55 'int main() { int i; int j; i=0; j=0; for (i=0; i<=10; i=i+1) j=i+j; r
 assert 3 'int main() { for(;;) return 3; return 5; }'
 
 assert 3 'int main() { return ret3(); }'
+assert 1 'int main() { return neg1() < 0; }'
+assert 1 'int main() { long x=neg1(); return x==-1; }'
+assert 7 'int *id(int *p) { return p; } int main() { int a[2]; a[1]=7; int *q; q=id(a); return q[1]; }'
+assert 1 'long sq(long x) { return x*x; } int main() { long y; y=sq(100000); return y/100000==100000; }'
+assert 1 'char *str() { return "ab"; } int main() { return str()[1]==98; }'
+assert 1 'long fact(long n) { if (n<=1) return 1; return n*fact(n-1); } int main() { return fact(20)/fact(19)==20; }'
 assert 5 'int main() { return ret5(); }'
 assert 8 'int main() { return add (3,5); }'
 assert 2 'int main() { return sub (5,3); }'
@@ -108,17 +234,20 @@ assert 55 'int main() { return fib(9); } int fib(int x) { if (x<=1) return 1; fi
 
 assert 3 'int main() { int x; x=3; return *&x; }'
 assert 3 'int main() { int x; int *y; int **z; x=3; y=&x; z=&y; return **z; }'
-assert 5 'int main() { int x; int y; x=3; y=5; return *(&x+1); }'
-assert 3 'int main() { int x; int y; x=3; y=5; return *(&y-1); }'
+assert_layout 5 'int main() { int x; int y; x=3; y=5; return *(&x+1); }'
+assert_layout 3 'int main() { int x; int y; x=3; y=5; return *(&y-1); }'
 assert 5 'int main() { int x; int *y; x=3; y=&x; *y=5; return x; }'
-assert 7 'int main() { int x; int y; x=3; y=5; *(&x+1)=7; return y; }'
-assert 7 'int main() { int x; int y; x=3; y=5; *(&y-1)=7; return x; }'
+assert_layout 7 'int main() { int x; int y; x=3; y=5; *(&x+1)=7; return y; }'
+assert_layout 7 'int main() { int x; int y; x=3; y=5; *(&y-1)=7; return x; }'
 assert 2 'int main() { int x; x=3; return (&x+2) - &x; }'
 assert 8 'int main() { int x; int y; x=3; y=5; return foo(&x, y); } int foo (int *x, int y) { return *x + y; }'
 
-#assert 4 'int main() { int x; return sizeof (x); }'
-assert 8 'int main() { int x; return sizeof (x); }'
+assert 4 'int main() { int x; return sizeof (x); }'
+assert 8 'int main() { long x; return sizeof (x); }'
 assert 8 'int main() { int x; return sizeof (&x); }'
+assert 4 'int main() { int x; x=3; return x < 5 ? x + 1 : x - 1; }'
+assert 2 'int main() { int x; x=3; return x < 2 ? x + 1 : x - 1; }'
+assert 6 'int main() { return min (6, 9) + max (-3, 0); } int min (int a, int b) { int m; if (a < b) m = a; else m = b; return m; } int max (int a, int b) { return a < b ? b : a; }'
 
 assert 3 'int main() { int a[2]; *a=1; *(a+1)=2; int *p; p=a; return *p + *(p+1); }'
 
@@ -137,8 +266,9 @@ assert 1 'int x[4]; int main() { x[0]=0; x[1]=1; x[2]=2; x[3]=3; return x[1]; }'
 assert 2 'int x[4]; int main() { x[0]=0; x[1]=1; x[2]=2; x[3]=3; return x[2]; }'
 assert 3 'int x[4]; int main() { x[0]=0; x[1]=1; x[2]=2; x[3]=3; return x[3]; }'
 
-assert 8 'int x; int main() { return sizeof (x); }'
-assert 32 'int x[4]; int main() { return sizeof (x); }'
+assert 4 'int x; int main() { return sizeof (x); }'
+assert 16 'int x[4]; int main() { return sizeof (x); }'
+assert 8 'long x; int main() { return sizeof (x); }'
 
 assert 1 'int main() { char x=1; return x; }'
 assert 1 'int main() { char x=1; char y=2; return x; }'
@@ -153,5 +283,211 @@ assert 98 'int main() { return "abc"[1]; }'
 assert 99 'int main() { return "abc"[2]; }'
 assert 0  'int main() { return "abc"[3]; }'
 assert 4  'int main() { return sizeof ("abc"); }'
+assert 2  'int main() { char *s; s="s"; return sizeof ("s"); }'
+
+if [ $serial = 0 ]; then
+  run_batch
+fi
+
+# Checks that a test named $1 produced $2, expected to be $3.
+expect () {
+  if [ "$2" = "$3" ]; then
+    echo "$1 => $2"
+  else
+    echo "$1 => $3 expected, but got $2"
+    exit 1
+  fi
+}
+
+# Prints "<hits> <misses>" from --cache-stats for the cache in $1.
+cache_stats () {
+  DCC_CACHE_DIR=$1 ./dcc --cache-stats 2>&1 |
+    sed -n 's/^ *total: *\([0-9]*\) hits, \([0-9]*\) misses.*/\1 \2/p'
+}
+
+# The compilation cache: compiling the same input again is a hit with
+# identical output, other codegen flags give another key, entries
+# beyond DCC_CACHE_SIZE are evicted, and editing an included header
+# gives another key.
+test_cache () {
+  local cache=$tmpdir/cache
+  local src=$tmpdir/cached.c
+  echo 'int main() { return 42; }' > $src
+
+  DCC_CACHE_DIR=$cache ./dcc $DCCFLAGS -o $tmpdir/cached1.s $src || exit 1
+  expect "cache: first compile" "$(cache_stats $cache)" "0 1"
+  DCC_CACHE_DIR=$cache ./dcc $DCCFLAGS -o $tmpdir/cached2.s $src || exit 1
+  expect "cache: same input" "$(cache_stats $cache)" "1 1"
+  cmp -s $tmpdir/cached1.s $tmpdir/cached2.s
+  expect "cache: identical output" $? 0
+  DCC_CACHE_DIR=$cache ./dcc $DCCFLAGS -g -o $tmpdir/cached3.s $src || exit 1
+  expect "cache: other flags" "$(cache_stats $cache)" "1 2"
+  expect "cache: entries" $(ls $cache/*.s | wc -l) 2
+
+  echo 'int main() { return 43; }' > $src
+  DCC_CACHE_DIR=$cache DCC_CACHE_SIZE=1 ./dcc $DCCFLAGS -o $tmpdir/cached4.s $src || exit 1
+  expect "cache: eviction" $(ls $cache/*.s 2>/dev/null | wc -l) 0
+
+  echo '#define V 1' > $tmpdir/cached.h
+  printf '#include "cached.h"\nint main() { return V; }\n' > $src
+  DCC_CACHE_DIR=$cache ./dcc $DCCFLAGS -o $tmpdir/cached5.s $src || exit 1
+  DCC_CACHE_DIR=$cache ./dcc $DCCFLAGS -o $tmpdir/cached6.s $src || exit 1
+  expect "cache: same header" "$(cache_stats $cache)" "2 4"
+  echo '#define V 2' > $tmpdir/cached.h
+  DCC_CACHE_DIR=$cache ./dcc $DCCFLAGS -o $tmpdir/cached7.s $src || exit 1
+  expect "cache: edited header" "$(cache_stats $cache)" "2 5"
+  ./dcc $DCCFLAGS -o $tmpdir/uncached.s $src || exit 1
+  cmp -s $tmpdir/cached7.s $tmpdir/uncached.s
+  expect "cache: output after a header edit" $? 0
+}
+
+# Incremental recompilation: after one function changes, only that
+# one is parsed again and the output matches a full compile.
+test_incremental () {
+  local src=$tmpdir/incr.c
+  printf '%s\n' 'int f1() { return 1; }' 'int f2() { return 2; }' \
+    'int main() { return f1() + f2(); }' > $src
+
+  ./dcc $DCCFLAGS -fincremental -o $tmpdir/incr1.s $src || exit 1
+  sed -i 's/return 2;/return 3;/' $src
+  local report=$(./dcc $DCCFLAGS -fincremental -fstats=json -o $tmpdir/incr2.s $src 2>&1)
+  expect "incremental: functions parsed" "$(echo "$report" | sed -n 's/.*"functions":\([0-9]*\).*/\1/p')" 1
+  ./dcc $DCCFLAGS -o $tmpdir/full.s $src || exit 1
+  cmp -s $tmpdir/incr2.s $tmpdir/full.s
+  expect "incremental: same as a full compile" $? 0
+}
+
+# Streaming and pipelined compilation emit functions as they are
+# parsed, which must not change the output.
+test_streaming () {
+  for mode in -fstreaming -fpipeline; do
+    ./dcc $DCCFLAGS $mode $tmpdir/batch.c > $tmpdir/streamed.s || exit 1
+    cmp -s $tmpdir/batch.s $tmpdir/streamed.s
+    expect "$mode: same as the default mode" $? 0
+  done
+}
+
+# Precompiled headers: a file compiled against the header's PCH gives
+# the same result as one with the header pasted in, and a PCH built
+# with other codegen flags is rejected.
+test_pch () {
+  local hdr=$tmpdir/pch.h
+  local src=$tmpdir/pch.c
+  printf '%s\n' '#define SCALE 3' 'int g;' 'int twice(int x) { return x * 2; }' \
+    'int scaled(int x) { return twice(x) * SCALE; }' > $hdr
+  echo 'int main() { g = 1; return scaled(2) + g; }' > $src
+  cat $hdr $src > $tmpdir/pch-full.c
+
+  ./dcc $DCCFLAGS --precompile -o $hdr.pch $hdr || exit 1
+  ./dcc $DCCFLAGS -include-pch $hdr.pch -o $tmpdir/pch.s $src || exit 1
+  gcc -static -o $tmpdir/pch $tmpdir/pch.s || exit 1
+  $tmpdir/pch
+  expect "pch: round trip" $? 13
+  ./dcc $DCCFLAGS -include-pch $hdr.pch --run $src
+  expect "pch: round trip with --run" $? 13
+  ./dcc $DCCFLAGS --run $tmpdir/pch-full.c
+  expect "pch: header pasted in" $? 13
+
+  ./dcc $DCCFLAGS -O -include-pch $hdr.pch -o /dev/null $src 2> $tmpdir/pch.err
+  expect "pch: other options" $? 1
+  expect "pch: other options error" "$(grep -c 'compiled with different options' $tmpdir/pch.err)" 1
+}
+
+# Prints the number of ret instructions in object file $1 at which
+# the CFI does not describe the caller's frame (CFA = rsp+8). Rows of
+# the frame table and rets are merged by address, a row applying from
+# its address on.
+bad_cfa_at_ret () {
+  {
+    readelf -wF $1 | awk '$1 ~ /^[0-9a-f]+$/ && length ($1) == 16 && $2 ~ /^r/ { print $1, "a", $2 }'
+    objdump -d --no-show-raw-insn $1 |
+      awk '$2 == "ret" { a = $1; sub (/:$/, "", a); print substr ("0000000000000000", 1, 16 - length (a)) a, "b" }'
+  } | sort | awk '$2 == "a" { cfa = $3 } $2 == "b" && cfa != "rsp+8" { bad++ } END { print bad + 0 }'
+}
+
+# Checks the -g output for $1 in assembly file $2: it must assemble
+# with DWARF line info, its CFI directives must pair up, and every
+# ret must see the caller's frame.
+check_cfi () {
+  as --gdwarf-5 -o $2.o $2
+  expect "$1: assembles" $? 0
+  expect "$1: .cfi_startproc/.cfi_endproc" \
+    "$(grep -c '\.cfi_startproc' $2)" "$(grep -c '\.cfi_endproc' $2)"
+  expect "$1: .cfi_remember_state/.cfi_restore_state" \
+    "$(grep -c '\.cfi_remember_state' $2)" "$(grep -c '\.cfi_restore_state' $2)"
+  expect "$1: CFA at ret" "$(bad_cfa_at_ret $2.o)" 0
+}
+
+# Line info and CFI (-g) for the whole batch
+test_debug_info () {
+  ./dcc $DCCFLAGS -g $tmpdir/batch.c > $tmpdir/debug.s || exit 1
+  check_cfi "-g" $tmpdir/debug.s
+  expect "-g: saved registers described" \
+    "$(grep -c '^  \.cfi_offset' $tmpdir/debug.s)" \
+    "$(grep -cE '^  (push rbp|mov \[rbp-[0-9]+\], (rbx|r1[2-5]))$' $tmpdir/debug.s)"
+}
+
+# A program whose hot () is called ten times and whose cold () never
+# runs. It returns 5.
+PROFILED='int cold() { return 7; }
+int hot(int x) { if (x > 100) return cold(); if (x < 5) return 1; return 0; }
+int main() { int i; int n; n = 0; for (i = 0; i < 10; i = i + 1) n = n + hot(i); return n; }'
+
+# One profile-guided cycle: an instrumented run records the calls,
+# and the build that uses the profile moves cold () and the call to
+# it out of the way without changing the result.
+test_profile () {
+  local src=$tmpdir/profiled.c
+  local prof=$tmpdir/dcc.prof
+  echo "$PROFILED" > $src
+
+  ./dcc $DCCFLAGS -fprofile-generate -o $tmpdir/profgen.s $src || exit 1
+  gcc -static -o $tmpdir/profgen $tmpdir/profgen.s runtime/profile.c || exit 1
+  DCC_PROFILE=$prof $tmpdir/profgen
+  expect "profile: instrumented run" $? 5
+  expect "profile: calls of hot" "$(sed -n 's/^hot [0-9]* \([0-9]*\).*/\1/p' $prof)" 10
+  expect "profile: calls of cold" "$(sed -n 's/^cold [0-9]* \([0-9]*\).*/\1/p' $prof)" 0
+
+  ./dcc $DCCFLAGS -g -fprofile-use=$prof -o $tmpdir/profuse.s $src || exit 1
+  gcc -static -o $tmpdir/profuse $tmpdir/profuse.s || exit 1
+  $tmpdir/profuse
+  expect "profile: optimized run" $? 5
+  expect "profile: last function" "$(grep -E '^[a-z]+:' $tmpdir/profuse.s | tail -1)" "cold:"
+  check_cfi "profile" $tmpdir/profuse.s
+}
+
+# Instrumented runs of the same program, through the hooks and with
+# inline rdtsc: the trace must hold the entry and exit of every call,
+# properly nested and in time order.
+test_trace () {
+  local src=$tmpdir/traced.c
+  echo "$PROFILED" > $src
+
+  local expected="B main"
+  for ((i = 0; i < 10; i++)); do
+    expected="$expected B hot E hot"
+  done
+  expected="$expected E main"
+
+  for mode in -finstrument-functions -finstrument-functions=rdtsc; do
+    ./dcc $DCCFLAGS $mode -o $tmpdir/traced.s $src || exit 1
+    gcc -static -pthread -o $tmpdir/traced $tmpdir/traced.s runtime/trace.c || exit 1
+    DCC_TRACE=$tmpdir/trace.json $tmpdir/traced
+    expect "$mode: run" $? 5
+    expect "$mode: events" \
+      "$(sed -n 's/.*"ph":"\(.\)".*"name":"\([^"]*\)".*/\1 \2/p' $tmpdir/trace.json | xargs)" "$expected"
+    sed -n 's/.*"ts":\([-0-9.]*\).*/\1/p' $tmpdir/trace.json | sort -c -g
+    expect "$mode: timestamps in order" $? 0
+  done
+}
 
+test_cache
+test_incremental
+test_profile
+test_trace
+test_pch
+if [ $serial = 0 ]; then
+  test_streaming
+  test_debug_info
+fi
 echo OK
@@ -0,0 +1,12 @@
+// Included twice by tests; the guard must keep the
+// second copy out.
+#ifndef TESTS_H
+#define TESTS_H
+
+#define SQUARE(x) ((x) * (x))
+
+int from_header () {
+  return 5;
+}
+
+#endif
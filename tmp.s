@@ -0,0 +1,11870 @@
+.intel_syntax noprefix
+.file 1 "tests"
+  .text
+.global from_header
+.type from_header, @function
+from_header:
+  .cfi_startproc
+  .file 2 "tests.h"
+  .loc 2 8 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 0
+  .file 2 "tests.h"
+  .loc 2 9 3
+  push 5
+  pop rax
+  jmp .L.return.from_header
+.L.return.from_header:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size from_header, .-from_header
+.global assert
+.type assert, @function
+assert:
+  .cfi_startproc
+  .loc 1 23 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], edi
+  mov [rbp-12], esi
+  mov [rbp-8], rdx
+  .loc 1 24 3
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-12]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.assert.0
+  .loc 1 25 5
+  push offset .L.data.assert.0
+  lea rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-12]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.assert.1
+  mov rax, 0
+  call printf
+  jmp .L.end.assert.1
+.L.call.assert.1:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.L.end.assert.1:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  jmp .L.end.assert.0
+.L.else.assert.0:
+  .loc 1 27 5
+  push offset .L.data.assert.1
+  lea rax, [rbp-8]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-12]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.assert.2
+  mov rax, 0
+  call printf
+  jmp .L.end.assert.2
+.L.call.assert.2:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.L.end.assert.2:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 28 5
+  push 1
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.assert.3
+  mov rax, 0
+  call exit
+  jmp .L.end.assert.3
+.L.call.assert.3:
+  sub rsp, 8
+  mov rax, 0
+  call exit
+  add rsp, 8
+.L.end.assert.3:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+.L.end.assert.0:
+  .loc 1 30 3
+  push 0
+  pop rax
+  jmp .L.return.assert
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size assert, .-assert
+  .data
+.L.data.assert.1:
+  .byte 0x25
+  .byte 0x73
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x3e
+  .byte 0x20
+  .byte 0x25
+  .byte 0x64
+  .byte 0x20
+  .byte 0x65
+  .byte 0x78
+  .byte 0x70
+  .byte 0x65
+  .byte 0x63
+  .byte 0x74
+  .byte 0x65
+  .byte 0x64
+  .byte 0x20
+  .byte 0x62
+  .byte 0x75
+  .byte 0x74
+  .byte 0x20
+  .byte 0x67
+  .byte 0x6f
+  .byte 0x74
+  .byte 0x20
+  .byte 0x25
+  .byte 0x64
+  .byte 0xa
+  .byte 0x0
+.L.data.assert.0:
+  .byte 0x25
+  .byte 0x73
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x3e
+  .byte 0x20
+  .byte 0x25
+  .byte 0x64
+  .byte 0xa
+  .byte 0x0
+  .text
+.global ret3
+.type ret3, @function
+ret3:
+  .cfi_startproc
+  .loc 1 34 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 0
+  .loc 1 35 3
+  push 3
+  pop rax
+  jmp .L.return.ret3
+  .loc 1 36 3
+  push 5
+  pop rax
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size ret3, .-ret3
+.global add2
+.type add2, @function
+add2:
+  .cfi_startproc
+  .loc 1 39 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  .loc 1 40 3
+  lea rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size add2, .-add2
+.global sub2
+.type sub2, @function
+sub2:
+  .cfi_startproc
+  .loc 1 43 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  .loc 1 44 3
+  lea rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sub2, .-sub2
+.global add6
+.type add6, @function
+add6:
+  .cfi_startproc
+  .loc 1 47 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 24
+  mov [rbp-24], edi
+  mov [rbp-20], esi
+  mov [rbp-16], edx
+  mov [rbp-12], ecx
+  mov [rbp-8], r8d
+  mov [rbp-4], r9d
+  .loc 1 48 3
+  lea rax, [rbp-24]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-12]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size add6, .-add6
+.global addx
+.type addx, @function
+addx:
+  .cfi_startproc
+  .loc 1 51 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-4], esi
+  .loc 1 52 3
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size addx, .-addx
+.global sub_char
+.type sub_char, @function
+sub_char:
+  .cfi_startproc
+  .loc 1 55 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  .loc 1 56 3
+  lea rax, [rbp-3]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  lea rax, [rbp-2]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  lea rax, [rbp-1]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sub_char, .-sub_char
+.global leaf
+.type leaf, @function
+leaf:
+  .cfi_startproc
+  .loc 1 61 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 32
+  mov [rbp-28], edi
+  mov [rbp-24], esi
+  .loc 1 62 3
+  lea rax, [rbp-20]
+  push rax
+  lea rax, [rbp-28]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 64 3
+  lea rax, [rbp-16]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  lea rax, [rbp-24]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 65 3
+  lea rax, [rbp-16]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 66 3
+  lea rax, [rbp-16]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  lea rax, [rbp-28]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-24]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 67 3
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-28]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.leaf
+.L.return.leaf:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size leaf, .-leaf
+.global leaf_ret
+.type leaf_ret, @function
+leaf_ret:
+  .cfi_startproc
+  .loc 1 70 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-4], edi
+  .loc 1 71 3
+  push 1
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.leaf_ret.0
+  push 5
+  pop rax
+  jmp .L.return.leaf_ret
+.L.end.leaf_ret.0:
+  push 2
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.leaf_ret
+.L.return.leaf_ret:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size leaf_ret, .-leaf_ret
+.global sum_calls
+.type sum_calls, @function
+sum_calls:
+  .cfi_startproc
+  .loc 1 76 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 32
+  mov [rbp-28], edi
+  mov [rbp-21], sil
+  .loc 1 77 3
+  lea rax, [rbp-20]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 78 3
+  lea rax, [rbp-16]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  .loc 1 80 3
+  lea rax, [rbp-4]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.begin.sum_calls.0:
+  .loc 1 80 17
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-28]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.sum_calls.0
+  .loc 1 81 5
+  lea rax, [rbp-20]
+  push rax
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-21]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.sum_calls.1
+  mov rax, 0
+  call add2
+  jmp .L.end.sum_calls.1
+.L.call.sum_calls.1:
+  sub rsp, 8
+  mov rax, 0
+  call add2
+  add rsp, 8
+.L.end.sum_calls.1:
+  movsxd rax, eax
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 82 5
+  lea rax, [rbp-16]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.sum_calls.2
+  mov rax, 0
+  call sub2
+  jmp .L.end.sum_calls.2
+.L.call.sum_calls.2:
+  sub rsp, 8
+  mov rax, 0
+  call sub2
+  add rsp, 8
+.L.end.sum_calls.2:
+  movsxd rax, eax
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  .loc 1 80 22
+  lea rax, [rbp-4]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.sum_calls.0
+.L.end.sum_calls.0:
+  .loc 1 84 3
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sum_calls
+.L.return.sum_calls:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size sum_calls, .-sum_calls
+.global char_wrap
+.type char_wrap, @function
+char_wrap:
+  .cfi_startproc
+  .loc 1 88 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  .loc 1 89 3
+  lea rax, [rbp-5]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  .loc 1 91 3
+  lea rax, [rbp-4]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.begin.char_wrap.0:
+  .loc 1 91 17
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 300
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.char_wrap.0
+  .loc 1 92 5
+  lea rax, [rbp-5]
+  push rax
+  lea rax, [rbp-5]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  .loc 1 91 24
+  lea rax, [rbp-4]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.char_wrap.0
+.L.end.char_wrap.0:
+  .loc 1 93 3
+  lea rax, [rbp-5]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  pop rax
+  jmp .L.return.char_wrap
+.L.return.char_wrap:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size char_wrap, .-char_wrap
+.global addr_taken
+.type addr_taken, @function
+addr_taken:
+  .cfi_startproc
+  .loc 1 97 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 24
+  mov [rbp-20], edi
+  .loc 1 98 3
+  lea rax, [rbp-16]
+  push rax
+  lea rax, [rbp-20]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  .loc 1 100 3
+  lea rax, [rbp-4]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.begin.addr_taken.0:
+  .loc 1 100 17
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.addr_taken.0
+  .loc 1 101 5
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-16]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 100 22
+  lea rax, [rbp-4]
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.addr_taken.0
+.L.end.addr_taken.0:
+  .loc 1 102 3
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  jmp .L.return.addr_taken
+.L.return.addr_taken:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size addr_taken, .-addr_taken
+.global fib
+.type fib, @function
+fib:
+  .cfi_startproc
+  .loc 1 105 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 8
+  mov [rbp-4], edi
+  .loc 1 106 3
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.fib.0
+  .loc 1 107 5
+  push 1
+  pop rax
+  jmp .L.return.fib
+  jmp .L.end.fib.0
+.L.else.fib.0:
+  .loc 1 109 5
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.fib.1
+  mov rax, 0
+  call fib
+  jmp .L.end.fib.1
+.L.call.fib.1:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.L.end.fib.1:
+  movsxd rax, eax
+  push rax
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.fib.2
+  mov rax, 0
+  call fib
+  jmp .L.end.fib.2
+.L.call.fib.2:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.L.end.fib.2:
+  movsxd rax, eax
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.fib
+.L.end.fib.0:
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size fib, .-fib
+.global main
+.type main, @function
+main:
+  .cfi_startproc
+  .loc 1 112 5
+  push rbp
+  .cfi_def_cfa_offset 16
+  .cfi_offset rbp, -16
+  mov rbp, rsp
+  .cfi_def_cfa_register rbp
+  sub rsp, 1280
+  .loc 1 114 3
+  push 0
+  push 0
+  push offset .L.data.main.0
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.0
+  mov rax, 0
+  call assert
+  jmp .L.end.main.0
+.L.call.main.0:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.0:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 115 3
+  push 42
+  push 42
+  push offset .L.data.main.1
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.1
+  mov rax, 0
+  call assert
+  jmp .L.end.main.1
+.L.call.main.1:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.1:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 116 3
+  push 5
+  push 5
+  push offset .L.data.main.2
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.2
+  mov rax, 0
+  call assert
+  jmp .L.end.main.2
+.L.call.main.2:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.2:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 117 3
+  push 41
+  push 12
+  push 34
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.3
+  mov rax, 0
+  call assert
+  jmp .L.end.main.3
+.L.call.main.3:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.3:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 118 3
+  push 15
+  push 5
+  push 9
+  push 6
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  push offset .L.data.main.4
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.4
+  mov rax, 0
+  call assert
+  jmp .L.end.main.4
+.L.call.main.4:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.4:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 119 3
+  push 4
+  push 3
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  push offset .L.data.main.5
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.5
+  mov rax, 0
+  call assert
+  jmp .L.end.main.5
+.L.call.main.5:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.5:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 120 3
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.6
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.6
+  mov rax, 0
+  call assert
+  jmp .L.end.main.6
+.L.call.main.6:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.6:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 121 3
+  push 10
+  push 0
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.7
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.7
+  mov rax, 0
+  call assert
+  jmp .L.end.main.7
+.L.call.main.7:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.7:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 122 3
+  push 10
+  push 0
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.8
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.8
+  mov rax, 0
+  call assert
+  jmp .L.end.main.8
+.L.call.main.8:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.8:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 124 3
+  push 0
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.9
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.9
+  mov rax, 0
+  call assert
+  jmp .L.end.main.9
+.L.call.main.9:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.9:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 125 3
+  push 1
+  push 42
+  push 42
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.10
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.10
+  mov rax, 0
+  call assert
+  jmp .L.end.main.10
+.L.call.main.10:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.10:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 126 3
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.11
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.11
+  mov rax, 0
+  call assert
+  jmp .L.end.main.11
+.L.call.main.11:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.11:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 127 3
+  push 0
+  push 42
+  push 42
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.12
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.12
+  mov rax, 0
+  call assert
+  jmp .L.end.main.12
+.L.call.main.12:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.12:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 129 3
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.13
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.13
+  mov rax, 0
+  call assert
+  jmp .L.end.main.13
+.L.call.main.13:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.13:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 130 3
+  push 0
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.14
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.14
+  mov rax, 0
+  call assert
+  jmp .L.end.main.14
+.L.call.main.14:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.14:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 131 3
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.15
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.15
+  mov rax, 0
+  call assert
+  jmp .L.end.main.15
+.L.call.main.15:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.15:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 132 3
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.16
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.16
+  mov rax, 0
+  call assert
+  jmp .L.end.main.16
+.L.call.main.16:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.16:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 133 3
+  push 1
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.17
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.17
+  mov rax, 0
+  call assert
+  jmp .L.end.main.17
+.L.call.main.17:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.17:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 134 3
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.18
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.18
+  mov rax, 0
+  call assert
+  jmp .L.end.main.18
+.L.call.main.18:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.18:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 136 3
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.19
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.19
+  mov rax, 0
+  call assert
+  jmp .L.end.main.19
+.L.call.main.19:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.19:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 137 3
+  push 0
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.20
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.20
+  mov rax, 0
+  call assert
+  jmp .L.end.main.20
+.L.call.main.20:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.20:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 138 3
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.21
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.21
+  mov rax, 0
+  call assert
+  jmp .L.end.main.21
+.L.call.main.21:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.21:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 139 3
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.22
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.22
+  mov rax, 0
+  call assert
+  jmp .L.end.main.22
+.L.call.main.22:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.22:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 140 3
+  push 1
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.23
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.23
+  mov rax, 0
+  call assert
+  jmp .L.end.main.23
+.L.call.main.23:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.23:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 141 3
+  push 1
+  push 1
+  push 2
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.24
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.24
+  mov rax, 0
+  call assert
+  jmp .L.end.main.24
+.L.call.main.24:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.24:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 143 3
+  push 3
+  lea rax, [rbp-1280]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1280]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.25
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.25
+  mov rax, 0
+  call assert
+  jmp .L.end.main.25
+.L.call.main.25:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.25:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 144 3
+  push 8
+  lea rax, [rbp-1276]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1272]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1276]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-1272]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.26
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.26
+  mov rax, 0
+  call assert
+  jmp .L.end.main.26
+.L.call.main.26:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.26:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 145 3
+  push 3
+  lea rax, [rbp-1268]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1268]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.27
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.27
+  mov rax, 0
+  call assert
+  jmp .L.end.main.27
+.L.call.main.27:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.27:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 146 3
+  push 8
+  lea rax, [rbp-1264]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1260]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1264]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-1260]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.28
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.28
+  mov rax, 0
+  call assert
+  jmp .L.end.main.28
+.L.call.main.28:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.28:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 148 3
+  push 3
+  lea rax, [rbp-1256]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1256]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.29
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.29
+  mov rax, 0
+  call assert
+  jmp .L.end.main.29
+.L.call.main.29:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.29:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 149 3
+  push 8
+  lea rax, [rbp-1252]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1248]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1252]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-1248]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.30
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.30
+  mov rax, 0
+  call assert
+  jmp .L.end.main.30
+.L.call.main.30:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.30:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 151 3
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.31
+  mov rax, 0
+  call ret3
+  jmp .L.end.main.31
+.L.call.main.31:
+  sub rsp, 8
+  mov rax, 0
+  call ret3
+  add rsp, 8
+.L.end.main.31:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.31
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.32
+  mov rax, 0
+  call assert
+  jmp .L.end.main.32
+.L.call.main.32:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.32:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 153 3
+  push 3
+  lea rax, [rbp-1244]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 0
+  je .L.else.main.33
+  lea rax, [rbp-1244]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.33
+.L.else.main.33:
+  lea rax, [rbp-1244]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.33:
+  lea rax, [rbp-1244]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.32
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.34
+  mov rax, 0
+  call assert
+  jmp .L.end.main.34
+.L.call.main.34:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.34:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 154 3
+  push 3
+  lea rax, [rbp-1240]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.35
+  lea rax, [rbp-1240]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.35
+.L.else.main.35:
+  lea rax, [rbp-1240]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.35:
+  lea rax, [rbp-1240]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.33
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.36
+  mov rax, 0
+  call assert
+  jmp .L.end.main.36
+.L.call.main.36:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.36:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 155 3
+  push 2
+  lea rax, [rbp-1236]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 0
+  je .L.else.main.37
+  lea rax, [rbp-1236]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.37
+.L.else.main.37:
+  lea rax, [rbp-1236]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.37:
+  lea rax, [rbp-1236]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.34
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.38
+  mov rax, 0
+  call assert
+  jmp .L.end.main.38
+.L.call.main.38:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.38:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 156 3
+  push 2
+  lea rax, [rbp-1232]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.39
+  lea rax, [rbp-1232]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.39
+.L.else.main.39:
+  lea rax, [rbp-1232]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.39:
+  lea rax, [rbp-1232]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.35
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.40
+  mov rax, 0
+  call assert
+  jmp .L.end.main.40
+.L.call.main.40:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.40:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 158 3
+  push 3
+  push 1
+  add rsp, 8
+  push 2
+  add rsp, 8
+  push 3
+  push offset .L.data.main.36
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.41
+  mov rax, 0
+  call assert
+  jmp .L.end.main.41
+.L.call.main.41:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.41:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 159 3
+  push 10
+  lea rax, [rbp-1228]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.42:
+  .loc 1 159 34
+  lea rax, [rbp-1228]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.main.42
+  lea rax, [rbp-1228]
+  push rax
+  lea rax, [rbp-1228]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.42
+.L.end.main.42:
+  lea rax, [rbp-1228]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.37
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.43
+  mov rax, 0
+  call assert
+  jmp .L.end.main.43
+.L.call.main.43:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.43:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 160 3
+  push 55
+  lea rax, [rbp-1224]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1220]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.44:
+  .loc 1 160 43
+  lea rax, [rbp-1224]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.main.44
+  lea rax, [rbp-1220]
+  push rax
+  lea rax, [rbp-1224]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-1220]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1224]
+  push rax
+  lea rax, [rbp-1224]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.44
+.L.end.main.44:
+  lea rax, [rbp-1220]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.38
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.45
+  mov rax, 0
+  call assert
+  jmp .L.end.main.45
+.L.call.main.45:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.45:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 161 3
+  push 55
+  lea rax, [rbp-1216]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1212]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1216]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.46:
+  .loc 1 161 46
+  lea rax, [rbp-1216]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.main.46
+  lea rax, [rbp-1212]
+  push rax
+  lea rax, [rbp-1216]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-1212]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1216]
+  push rax
+  lea rax, [rbp-1216]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.46
+.L.end.main.46:
+  lea rax, [rbp-1212]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.39
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.47
+  mov rax, 0
+  call assert
+  jmp .L.end.main.47
+.L.call.main.47:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.47:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 163 3
+  push 8
+  push 5
+  push 3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.48
+  mov rax, 0
+  call add2
+  jmp .L.end.main.48
+.L.call.main.48:
+  sub rsp, 8
+  mov rax, 0
+  call add2
+  add rsp, 8
+.L.end.main.48:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.40
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.49
+  mov rax, 0
+  call assert
+  jmp .L.end.main.49
+.L.call.main.49:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.49:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 164 3
+  push 2
+  push 5
+  push 3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.50
+  mov rax, 0
+  call sub2
+  jmp .L.end.main.50
+.L.call.main.50:
+  sub rsp, 8
+  mov rax, 0
+  call sub2
+  add rsp, 8
+.L.end.main.50:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.41
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.51
+  mov rax, 0
+  call assert
+  jmp .L.end.main.51
+.L.call.main.51:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.51:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 165 3
+  push 21
+  push 1
+  push 2
+  push 3
+  push 4
+  push 5
+  push 6
+  pop r9
+  pop r8
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.52
+  mov rax, 0
+  call add6
+  jmp .L.end.main.52
+.L.call.main.52:
+  sub rsp, 8
+  mov rax, 0
+  call add6
+  add rsp, 8
+.L.end.main.52:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.42
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.53
+  mov rax, 0
+  call assert
+  jmp .L.end.main.53
+.L.call.main.53:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.53:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 166 3
+  push 55
+  push 9
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.54
+  mov rax, 0
+  call fib
+  jmp .L.end.main.54
+.L.call.main.54:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.L.end.main.54:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.43
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.55
+  mov rax, 0
+  call assert
+  jmp .L.end.main.55
+.L.call.main.55:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.55:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 168 3
+  push 3
+  lea rax, [rbp-1208]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1208]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.44
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.56
+  mov rax, 0
+  call assert
+  jmp .L.end.main.56
+.L.call.main.56:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.56:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 169 3
+  push 3
+  lea rax, [rbp-1204]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1200]
+  push rax
+  lea rax, [rbp-1204]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1192]
+  push rax
+  lea rax, [rbp-1200]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1192]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.45
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.57
+  mov rax, 0
+  call assert
+  jmp .L.end.main.57
+.L.call.main.57:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.57:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 170 3
+  push 5
+  lea rax, [rbp-1180]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1176]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1180]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.46
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.58
+  mov rax, 0
+  call assert
+  jmp .L.end.main.58
+.L.call.main.58:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.58:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 171 3
+  push 5
+  lea rax, [rbp-1172]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1168]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1172]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.47
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.59
+  mov rax, 0
+  call assert
+  jmp .L.end.main.59
+.L.call.main.59:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.59:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 172 3
+  push 3
+  lea rax, [rbp-1164]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1160]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1160]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.48
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.60
+  mov rax, 0
+  call assert
+  jmp .L.end.main.60
+.L.call.main.60:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.60:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 173 3
+  push 2
+  lea rax, [rbp-1156]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1156]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  lea rax, [rbp-1156]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 4
+  idiv rdi
+  push rax
+  push offset .L.data.main.49
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.61
+  mov rax, 0
+  call assert
+  jmp .L.end.main.61
+.L.call.main.61:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.61:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 176 3
+  push 5
+  lea rax, [rbp-1152]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1148]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1144]
+  push rax
+  lea rax, [rbp-1152]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1144]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.50
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.62
+  mov rax, 0
+  call assert
+  jmp .L.end.main.62
+.L.call.main.62:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.62:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 177 3
+  push 3
+  lea rax, [rbp-1136]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1132]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1128]
+  push rax
+  lea rax, [rbp-1132]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1128]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.51
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.63
+  mov rax, 0
+  call assert
+  jmp .L.end.main.63
+.L.call.main.63:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.63:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 178 3
+  push 5
+  lea rax, [rbp-1116]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1112]
+  push rax
+  lea rax, [rbp-1116]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1112]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1116]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.52
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.64
+  mov rax, 0
+  call assert
+  jmp .L.end.main.64
+.L.call.main.64:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.64:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 179 3
+  push 7
+  lea rax, [rbp-1104]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1100]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1104]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1100]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.53
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.65
+  mov rax, 0
+  call assert
+  jmp .L.end.main.65
+.L.call.main.65:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.65:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 180 3
+  push 7
+  lea rax, [rbp-1096]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1092]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1092]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1096]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.54
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.66
+  mov rax, 0
+  call assert
+  jmp .L.end.main.66
+.L.call.main.66:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.66:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 181 3
+  push 8
+  lea rax, [rbp-1088]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1084]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1088]
+  push rax
+  lea rax, [rbp-1084]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.67
+  mov rax, 0
+  call addx
+  jmp .L.end.main.67
+.L.call.main.67:
+  sub rsp, 8
+  mov rax, 0
+  call addx
+  add rsp, 8
+.L.end.main.67:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.55
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.68
+  mov rax, 0
+  call assert
+  jmp .L.end.main.68
+.L.call.main.68:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.68:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 183 3
+  push 3
+  lea rax, [rbp-1072]
+  push rax
+  lea rax, [rbp-1080]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1072]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1080]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.56
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.69
+  mov rax, 0
+  call assert
+  jmp .L.end.main.69
+.L.call.main.69:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.69:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 185 3
+  push 3
+  lea rax, [rbp-1060]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1060]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1060]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1060]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.57
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.70
+  mov rax, 0
+  call assert
+  jmp .L.end.main.70
+.L.call.main.70:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.70:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 186 3
+  push 4
+  lea rax, [rbp-1048]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1048]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1048]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1048]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.58
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.71
+  mov rax, 0
+  call assert
+  jmp .L.end.main.71
+.L.call.main.71:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.71:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 187 3
+  push 5
+  lea rax, [rbp-1036]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1036]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1036]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1036]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.59
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.72
+  mov rax, 0
+  call assert
+  jmp .L.end.main.72
+.L.call.main.72:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.72:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 190 3
+  push 0
+  lea rax, [rbp-1000]
+  push rax
+  lea rax, [rbp-1024]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1000]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-1024]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.60
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.73
+  mov rax, 0
+  call assert
+  jmp .L.end.main.73
+.L.call.main.73:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.73:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 191 3
+  push 1
+  lea rax, [rbp-968]
+  push rax
+  lea rax, [rbp-992]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-968]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-992]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.61
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.74
+  mov rax, 0
+  call assert
+  jmp .L.end.main.74
+.L.call.main.74:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.74:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 192 3
+  push 2
+  lea rax, [rbp-936]
+  push rax
+  lea rax, [rbp-960]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-936]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-960]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.62
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.75
+  mov rax, 0
+  call assert
+  jmp .L.end.main.75
+.L.call.main.75:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.75:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 193 3
+  push 3
+  lea rax, [rbp-904]
+  push rax
+  lea rax, [rbp-928]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-904]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-928]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.63
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.76
+  mov rax, 0
+  call assert
+  jmp .L.end.main.76
+.L.call.main.76:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.76:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 194 3
+  push 4
+  lea rax, [rbp-872]
+  push rax
+  lea rax, [rbp-896]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-872]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-896]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.64
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.77
+  mov rax, 0
+  call assert
+  jmp .L.end.main.77
+.L.call.main.77:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.77:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 195 3
+  push 5
+  lea rax, [rbp-840]
+  push rax
+  lea rax, [rbp-864]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-840]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-864]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.65
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.78
+  mov rax, 0
+  call assert
+  jmp .L.end.main.78
+.L.call.main.78:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.78:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 197 3
+  push 3
+  lea rax, [rbp-828]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-828]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-828]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-828]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.66
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.79
+  mov rax, 0
+  call assert
+  jmp .L.end.main.79
+.L.call.main.79:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.79:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 198 3
+  push 4
+  lea rax, [rbp-816]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-816]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-816]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-816]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.67
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.80
+  mov rax, 0
+  call assert
+  jmp .L.end.main.80
+.L.call.main.80:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.80:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 199 3
+  push 5
+  lea rax, [rbp-804]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-804]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-804]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-804]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.68
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.81
+  mov rax, 0
+  call assert
+  jmp .L.end.main.81
+.L.call.main.81:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.81:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 201 3
+  push 0
+  lea rax, [rbp-768]
+  push rax
+  lea rax, [rbp-792]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-768]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-792]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.69
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.82
+  mov rax, 0
+  call assert
+  jmp .L.end.main.82
+.L.call.main.82:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.82:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 202 3
+  push 1
+  lea rax, [rbp-736]
+  push rax
+  lea rax, [rbp-760]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-736]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-760]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.70
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.83
+  mov rax, 0
+  call assert
+  jmp .L.end.main.83
+.L.call.main.83:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.83:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 203 3
+  push 2
+  lea rax, [rbp-704]
+  push rax
+  lea rax, [rbp-728]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-704]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-728]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.71
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.84
+  mov rax, 0
+  call assert
+  jmp .L.end.main.84
+.L.call.main.84:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.84:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 204 3
+  push 3
+  lea rax, [rbp-672]
+  push rax
+  lea rax, [rbp-696]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-672]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-696]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.72
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.85
+  mov rax, 0
+  call assert
+  jmp .L.end.main.85
+.L.call.main.85:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.85:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 205 3
+  push 4
+  lea rax, [rbp-640]
+  push rax
+  lea rax, [rbp-664]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-640]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-664]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.73
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.86
+  mov rax, 0
+  call assert
+  jmp .L.end.main.86
+.L.call.main.86:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.86:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 206 3
+  push 5
+  lea rax, [rbp-608]
+  push rax
+  lea rax, [rbp-632]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-608]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-632]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.74
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.87
+  mov rax, 0
+  call assert
+  jmp .L.end.main.87
+.L.call.main.87:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.87:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 208 3
+  push 4
+  push 4
+  push offset .L.data.main.75
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.88
+  mov rax, 0
+  call assert
+  jmp .L.end.main.88
+.L.call.main.88:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.88:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 209 3
+  push 4
+  push 4
+  push offset .L.data.main.76
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.89
+  mov rax, 0
+  call assert
+  jmp .L.end.main.89
+.L.call.main.89:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.89:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 210 3
+  push 8
+  push 8
+  push offset .L.data.main.77
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.90
+  mov rax, 0
+  call assert
+  jmp .L.end.main.90
+.L.call.main.90:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.90:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 211 3
+  push 16
+  push 16
+  push offset .L.data.main.78
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.91
+  mov rax, 0
+  call assert
+  jmp .L.end.main.91
+.L.call.main.91:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.91:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 212 3
+  push 48
+  push 48
+  push offset .L.data.main.79
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.92
+  mov rax, 0
+  call assert
+  jmp .L.end.main.92
+.L.call.main.92:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.92:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 213 3
+  push 16
+  push 16
+  push offset .L.data.main.80
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.93
+  mov rax, 0
+  call assert
+  jmp .L.end.main.93
+.L.call.main.93:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.93:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 214 3
+  push 4
+  push 4
+  push offset .L.data.main.81
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.94
+  mov rax, 0
+  call assert
+  jmp .L.end.main.94
+.L.call.main.94:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.94:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 215 3
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.82
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.95
+  mov rax, 0
+  call assert
+  jmp .L.end.main.95
+.L.call.main.95:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.95:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 216 3
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.83
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.96
+  mov rax, 0
+  call assert
+  jmp .L.end.main.96
+.L.call.main.96:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.96:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 217 3
+  push 4
+  push 4
+  push offset .L.data.main.84
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.97
+  mov rax, 0
+  call assert
+  jmp .L.end.main.97
+.L.call.main.97:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.97:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 219 3
+  push 0
+  push offset g1
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.85
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.98
+  mov rax, 0
+  call assert
+  jmp .L.end.main.98
+.L.call.main.98:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.98:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 220 3
+  push offset g1
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 221 3
+  push 3
+  push offset g1
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.86
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.99
+  mov rax, 0
+  call assert
+  jmp .L.end.main.99
+.L.call.main.99:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.99:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 223 3
+  push offset g2
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g2
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g2
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g2
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  .loc 1 224 3
+  push 0
+  push offset g2
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.87
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.100
+  mov rax, 0
+  call assert
+  jmp .L.end.main.100
+.L.call.main.100:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.100:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 225 3
+  push 1
+  push offset g2
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.88
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.101
+  mov rax, 0
+  call assert
+  jmp .L.end.main.101
+.L.call.main.101:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.101:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 226 3
+  push 2
+  push offset g2
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.89
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.102
+  mov rax, 0
+  call assert
+  jmp .L.end.main.102
+.L.call.main.102:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.102:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 227 3
+  push 3
+  push offset g2
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.90
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.103
+  mov rax, 0
+  call assert
+  jmp .L.end.main.103
+.L.call.main.103:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.103:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 229 3
+  push 4
+  push 4
+  push offset .L.data.main.91
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.104
+  mov rax, 0
+  call assert
+  jmp .L.end.main.104
+.L.call.main.104:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.104:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 230 3
+  push 16
+  push 16
+  push offset .L.data.main.92
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.105
+  mov rax, 0
+  call assert
+  jmp .L.end.main.105
+.L.call.main.105:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.105:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 231 3
+  push 2
+  push 1
+  pop rax
+  cmp rax, 0
+  je .L.else.main.106
+  push 2
+  jmp .L.end.main.106
+.L.else.main.106:
+  push 3
+.L.end.main.106:
+  push offset .L.data.main.93
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.107
+  mov rax, 0
+  call assert
+  jmp .L.end.main.107
+.L.call.main.107:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.107:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 232 3
+  push 3
+  push 0
+  pop rax
+  cmp rax, 0
+  je .L.else.main.108
+  push 2
+  jmp .L.end.main.108
+.L.else.main.108:
+  push 3
+.L.end.main.108:
+  push offset .L.data.main.94
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.109
+  mov rax, 0
+  call assert
+  jmp .L.end.main.109
+.L.call.main.109:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.109:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 233 3
+  push 4
+  lea rax, [rbp-280]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-276]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-280]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.110
+  lea rax, [rbp-276]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.111
+  push 3
+  jmp .L.end.main.111
+.L.else.main.111:
+  push 4
+.L.end.main.111:
+  jmp .L.end.main.110
+.L.else.main.110:
+  push 5
+.L.end.main.110:
+  push offset .L.data.main.95
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.112
+  mov rax, 0
+  call assert
+  jmp .L.end.main.112
+.L.call.main.112:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.112:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 234 3
+  push 7
+  lea rax, [rbp-272]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-272]
+  push rax
+  lea rax, [rbp-272]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.113
+  push 7
+  jmp .L.end.main.113
+.L.else.main.113:
+  push 8
+.L.end.main.113:
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-272]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.96
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.114
+  mov rax, 0
+  call assert
+  jmp .L.end.main.114
+.L.call.main.114:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.114:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 235 3
+  push 1
+  lea rax, [rbp-268]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 0
+  je .L.else.main.115
+  lea rax, [rbp-268]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  jmp .L.end.main.115
+.L.else.main.115:
+  push 1
+.L.end.main.115:
+  push offset .L.data.main.97
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.116
+  mov rax, 0
+  call assert
+  jmp .L.end.main.116
+.L.call.main.116:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.116:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 236 3
+  push 0
+  lea rax, [rbp-264]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 0
+  je .L.else.main.117
+  lea rax, [rbp-264]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  jmp .L.end.main.117
+.L.else.main.117:
+  push 1
+.L.end.main.117:
+  add rsp, 8
+  lea rax, [rbp-264]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.98
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.118
+  mov rax, 0
+  call assert
+  jmp .L.end.main.118
+.L.call.main.118:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.118:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 237 3
+  push 5
+  lea rax, [rbp-260]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 0
+  je .L.else.main.119
+  lea rax, [rbp-260]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  jmp .L.end.main.119
+.L.else.main.119:
+  lea rax, [rbp-260]
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+.L.end.main.119:
+  add rsp, 8
+  lea rax, [rbp-260]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.99
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.120
+  mov rax, 0
+  call assert
+  jmp .L.end.main.120
+.L.call.main.120:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.120:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 238 3
+  push 3
+  lea rax, [rbp-256]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-256]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-248]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-248]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.121
+  lea rax, [rbp-248]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  jmp .L.end.main.121
+.L.else.main.121:
+  lea rax, [rbp-256]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+.L.end.main.121:
+  push offset .L.data.main.100
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.122
+  mov rax, 0
+  call assert
+  jmp .L.end.main.122
+.L.call.main.122:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.122:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 239 3
+  push 5
+  lea rax, [rbp-236]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-232]
+  push rax
+  lea rax, [rbp-236]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-224]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-224]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.123
+  push 0
+  jmp .L.end.main.123
+.L.else.main.123:
+  lea rax, [rbp-232]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+.L.end.main.123:
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.101
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.124
+  mov rax, 0
+  call assert
+  jmp .L.end.main.124
+.L.call.main.124:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.124:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 240 3
+  push 1
+  lea rax, [rbp-220]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-216]
+  push rax
+  lea rax, [rbp-220]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-204]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-204]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.125
+  lea rax, [rbp-216]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  jmp .L.end.main.125
+.L.else.main.125:
+  push 0
+.L.end.main.125:
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  lea rax, [rbp-216]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 4
+  idiv rdi
+  push rax
+  push offset .L.data.main.102
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.126
+  mov rax, 0
+  call assert
+  jmp .L.end.main.126
+.L.call.main.126:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.126:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 241 3
+  push 4
+  lea rax, [rbp-200]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-192]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-192]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.127
+  push 0
+  jmp .L.end.main.127
+.L.else.main.127:
+  lea rax, [rbp-200]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+.L.end.main.127:
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.103
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.128
+  mov rax, 0
+  call assert
+  jmp .L.end.main.128
+.L.call.main.128:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.128:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 242 3
+  push 8
+  lea rax, [rbp-180]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 8
+  push offset .L.data.main.104
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.129
+  mov rax, 0
+  call assert
+  jmp .L.end.main.129
+.L.call.main.129:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.129:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 243 3
+  push 3
+  lea rax, [rbp-176]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-172]
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-168]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-176]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-172]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.130
+  lea rax, [rbp-168]
+  push rax
+  lea rax, [rbp-176]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.130
+.L.else.main.130:
+  lea rax, [rbp-168]
+  push rax
+  lea rax, [rbp-172]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.130:
+  lea rax, [rbp-168]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.105
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.131
+  mov rax, 0
+  call assert
+  jmp .L.end.main.131
+.L.call.main.131:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.131:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 244 3
+  push 7
+  lea rax, [rbp-164]
+  push rax
+  push 9
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-160]
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-156]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-164]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-160]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.else.main.132
+  lea rax, [rbp-156]
+  push rax
+  lea rax, [rbp-164]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.132
+.L.else.main.132:
+  lea rax, [rbp-156]
+  push rax
+  lea rax, [rbp-160]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.132:
+  lea rax, [rbp-156]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.106
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.133
+  mov rax, 0
+  call assert
+  jmp .L.end.main.133
+.L.call.main.133:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.133:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 245 3
+  push 10
+  lea rax, [rbp-152]
+  push rax
+  push 12
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 10
+  lea rax, [rbp-152]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.main.134
+  lea rax, [rbp-152]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.134:
+  lea rax, [rbp-152]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.107
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.135
+  mov rax, 0
+  call assert
+  jmp .L.end.main.135
+.L.call.main.135:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.135:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 246 3
+  push 4
+  lea rax, [rbp-148]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 10
+  lea rax, [rbp-148]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je .L.end.main.136
+  lea rax, [rbp-148]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.end.main.136:
+  lea rax, [rbp-148]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.108
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.137
+  mov rax, 0
+  call assert
+  jmp .L.end.main.137
+.L.call.main.137:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.137:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 247 3
+  push 3
+  push offset g3
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.109
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.138
+  mov rax, 0
+  call assert
+  jmp .L.end.main.138
+.L.call.main.138:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.138:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 248 3
+  push 6
+  push offset g4
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset g4
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset g4
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset g4
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.110
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.139
+  mov rax, 0
+  call assert
+  jmp .L.end.main.139
+.L.call.main.139:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.139:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 249 3
+  push 8
+  push 8
+  push offset .L.data.main.111
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.140
+  mov rax, 0
+  call assert
+  jmp .L.end.main.140
+.L.call.main.140:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.140:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 250 3
+  push 7
+  push offset g5
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.112
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.141
+  mov rax, 0
+  call assert
+  jmp .L.end.main.141
+.L.call.main.141:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.141:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 252 3
+  push 8
+  push 8
+  push offset .L.data.main.113
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.142
+  mov rax, 0
+  call assert
+  jmp .L.end.main.142
+.L.call.main.142:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.142:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 253 3
+  push 32
+  push 32
+  push offset .L.data.main.114
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.143
+  mov rax, 0
+  call assert
+  jmp .L.end.main.143
+.L.call.main.143:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.143:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 254 3
+  push 8
+  push 8
+  push offset .L.data.main.115
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.144
+  mov rax, 0
+  call assert
+  jmp .L.end.main.144
+.L.call.main.144:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.144:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 255 3
+  push 0
+  lea rax, [rbp-84]
+  push rax
+  push 65536
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-84]
+  push rax
+  lea rax, [rbp-84]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  lea rax, [rbp-84]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-84]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.116
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.145
+  mov rax, 0
+  call assert
+  jmp .L.end.main.145
+.L.call.main.145:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.145:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 256 3
+  push 65536
+  lea rax, [rbp-80]
+  push rax
+  push 65536
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-80]
+  push rax
+  lea rax, [rbp-80]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-80]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-80]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 65536
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  push offset .L.data.main.117
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.146
+  mov rax, 0
+  call assert
+  jmp .L.end.main.146
+.L.call.main.146:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.146:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 257 3
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  lea rax, [rbp-68]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-68]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-68]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.118
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.147
+  mov rax, 0
+  call assert
+  jmp .L.end.main.147
+.L.call.main.147:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.147:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 258 3
+  push 5
+  lea rax, [rbp-57]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-56]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-48]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-57]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  lea rax, [rbp-56]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-48]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.119
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.148
+  mov rax, 0
+  call assert
+  jmp .L.end.main.148
+.L.call.main.148:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.148:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 260 3
+  push 1
+  lea rax, [rbp-44]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-44]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.120
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.149
+  mov rax, 0
+  call assert
+  jmp .L.end.main.149
+.L.call.main.149:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.149:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 261 3
+  push 1
+  lea rax, [rbp-43]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-42]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-43]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.121
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.150
+  mov rax, 0
+  call assert
+  jmp .L.end.main.150
+.L.call.main.150:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.150:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 262 3
+  push 2
+  lea rax, [rbp-41]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-40]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-40]
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.122
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.151
+  mov rax, 0
+  call assert
+  jmp .L.end.main.151
+.L.call.main.151:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.151:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 264 3
+  push 1
+  push 1
+  push offset .L.data.main.123
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.152
+  mov rax, 0
+  call assert
+  jmp .L.end.main.152
+.L.call.main.152:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.152:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 265 3
+  push 10
+  push 10
+  push offset .L.data.main.124
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.153
+  mov rax, 0
+  call assert
+  jmp .L.end.main.153
+.L.call.main.153:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.153:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 266 3
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.154
+  mov rax, 0
+  call sub_char
+  jmp .L.end.main.154
+.L.call.main.154:
+  sub rsp, 8
+  mov rax, 0
+  call sub_char
+  add rsp, 8
+.L.end.main.154:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.125
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.155
+  mov rax, 0
+  call assert
+  jmp .L.end.main.155
+.L.call.main.155:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.155:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 267 3
+  push 0
+  push 110
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 3
+  push 4
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.156
+  mov rax, 0
+  call leaf
+  jmp .L.end.main.156
+.L.call.main.156:
+  sub rsp, 8
+  mov rax, 0
+  call leaf
+  add rsp, 8
+.L.end.main.156:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.126
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.157
+  mov rax, 0
+  call assert
+  jmp .L.end.main.157
+.L.call.main.157:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.157:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 268 3
+  push 24
+  push 4
+  push 1
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.158
+  mov rax, 0
+  call sum_calls
+  jmp .L.end.main.158
+.L.call.main.158:
+  sub rsp, 8
+  mov rax, 0
+  call sum_calls
+  add rsp, 8
+.L.end.main.158:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.127
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.159
+  mov rax, 0
+  call assert
+  jmp .L.end.main.159
+.L.call.main.159:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.159:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 269 3
+  push 44
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.160
+  mov rax, 0
+  call char_wrap
+  jmp .L.end.main.160
+.L.call.main.160:
+  sub rsp, 8
+  mov rax, 0
+  call char_wrap
+  add rsp, 8
+.L.end.main.160:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.128
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.161
+  mov rax, 0
+  call assert
+  jmp .L.end.main.161
+.L.call.main.161:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.161:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 270 3
+  push 7
+  push 4
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.162
+  mov rax, 0
+  call addr_taken
+  jmp .L.end.main.162
+.L.call.main.162:
+  sub rsp, 8
+  mov rax, 0
+  call addr_taken
+  add rsp, 8
+.L.end.main.162:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.129
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.163
+  mov rax, 0
+  call assert
+  jmp .L.end.main.163
+.L.call.main.163:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.163:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 271 3
+  push 5
+  push 1
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.164
+  mov rax, 0
+  call leaf_ret
+  jmp .L.end.main.164
+.L.call.main.164:
+  sub rsp, 8
+  mov rax, 0
+  call leaf_ret
+  add rsp, 8
+.L.end.main.164:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.130
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.165
+  mov rax, 0
+  call assert
+  jmp .L.end.main.165
+.L.call.main.165:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.165:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 272 3
+  push 3
+  push 0
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.166
+  mov rax, 0
+  call leaf_ret
+  jmp .L.end.main.166
+.L.call.main.166:
+  sub rsp, 8
+  mov rax, 0
+  call leaf_ret
+  add rsp, 8
+.L.end.main.166:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.131
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.167
+  mov rax, 0
+  call assert
+  jmp .L.end.main.167
+.L.call.main.167:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.167:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 274 3
+  push 97
+  push offset .L.data.main.132
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.133
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.168
+  mov rax, 0
+  call assert
+  jmp .L.end.main.168
+.L.call.main.168:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.168:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 275 3
+  push 98
+  push offset .L.data.main.134
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.135
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.169
+  mov rax, 0
+  call assert
+  jmp .L.end.main.169
+.L.call.main.169:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.169:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 276 3
+  push 99
+  push offset .L.data.main.136
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.137
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.170
+  mov rax, 0
+  call assert
+  jmp .L.end.main.170
+.L.call.main.170:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.170:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 277 3
+  push 0
+  push offset .L.data.main.138
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.139
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.171
+  mov rax, 0
+  call assert
+  jmp .L.end.main.171
+.L.call.main.171:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.171:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 278 3
+  push 4
+  push 4
+  push offset .L.data.main.141
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.172
+  mov rax, 0
+  call assert
+  jmp .L.end.main.172
+.L.call.main.172:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.172:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 280 3
+  push 7
+  push offset .L.data.main.142
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.143
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.173
+  mov rax, 0
+  call assert
+  jmp .L.end.main.173
+.L.call.main.173:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.173:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 281 3
+  push 8
+  push offset .L.data.main.144
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.145
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.174
+  mov rax, 0
+  call assert
+  jmp .L.end.main.174
+.L.call.main.174:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.174:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 282 3
+  push 9
+  push offset .L.data.main.146
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.147
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.175
+  mov rax, 0
+  call assert
+  jmp .L.end.main.175
+.L.call.main.175:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.175:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 283 3
+  push 10
+  push offset .L.data.main.148
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.149
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.176
+  mov rax, 0
+  call assert
+  jmp .L.end.main.176
+.L.call.main.176:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.176:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 284 3
+  push 11
+  push offset .L.data.main.150
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.151
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.177
+  mov rax, 0
+  call assert
+  jmp .L.end.main.177
+.L.call.main.177:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.177:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 285 3
+  push 12
+  push offset .L.data.main.152
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.153
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.178
+  mov rax, 0
+  call assert
+  jmp .L.end.main.178
+.L.call.main.178:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.178:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 286 3
+  push 13
+  push offset .L.data.main.154
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.155
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.179
+  mov rax, 0
+  call assert
+  jmp .L.end.main.179
+.L.call.main.179:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.179:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 287 3
+  push 27
+  push offset .L.data.main.156
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.157
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.180
+  mov rax, 0
+  call assert
+  jmp .L.end.main.180
+.L.call.main.180:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.180:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 288 3
+  push 0
+  push offset .L.data.main.158
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.159
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.181
+  mov rax, 0
+  call assert
+  jmp .L.end.main.181
+.L.call.main.181:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.181:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 290 3
+  push 106
+  push offset .L.data.main.160
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.161
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.182
+  mov rax, 0
+  call assert
+  jmp .L.end.main.182
+.L.call.main.182:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.182:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 291 3
+  push 107
+  push offset .L.data.main.162
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.163
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.183
+  mov rax, 0
+  call assert
+  jmp .L.end.main.183
+.L.call.main.183:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.183:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 292 3
+  push 108
+  push offset .L.data.main.164
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, BYTE PTR [rax]
+  push rax
+  push offset .L.data.main.165
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.184
+  mov rax, 0
+  call assert
+  jmp .L.end.main.184
+.L.call.main.184:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.184:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 294 3
+  push 2
+  lea rax, [rbp-28]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-24]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-28]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.166
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.185
+  mov rax, 0
+  call assert
+  jmp .L.end.main.185
+.L.call.main.185:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.185:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 295 3
+  push 2
+  lea rax, [rbp-20]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-16]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-12]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-20]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.167
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.186
+  mov rax, 0
+  call assert
+  jmp .L.end.main.186
+.L.call.main.186:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.186:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 296 3
+  push 3
+  lea rax, [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-8]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-8]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.168
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.187
+  mov rax, 0
+  call assert
+  jmp .L.end.main.187
+.L.call.main.187:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.187:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 298 3
+  push 3
+  push offset g3
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.169
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.188
+  mov rax, 0
+  call assert
+  jmp .L.end.main.188
+.L.call.main.188:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.188:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 299 3
+  push 0
+  push offset g4
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.170
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.189
+  mov rax, 0
+  call assert
+  jmp .L.end.main.189
+.L.call.main.189:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.189:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 300 3
+  push 1
+  push offset g4
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.171
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.190
+  mov rax, 0
+  call assert
+  jmp .L.end.main.190
+.L.call.main.190:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.190:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 301 3
+  push 2
+  push offset g4
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.172
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.191
+  mov rax, 0
+  call assert
+  jmp .L.end.main.191
+.L.call.main.191:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.191:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 302 3
+  push 3
+  push offset g4
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.173
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.192
+  mov rax, 0
+  call assert
+  jmp .L.end.main.192
+.L.call.main.192:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.192:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 304 3
+  push 10
+  push 10
+  push offset .L.data.main.174
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.193
+  mov rax, 0
+  call assert
+  jmp .L.end.main.193
+.L.call.main.193:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.193:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 305 3
+  push 7
+  push 3
+  push 4
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.175
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.194
+  mov rax, 0
+  call assert
+  jmp .L.end.main.194
+.L.call.main.194:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.194:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 306 3
+  push 49
+  push 3
+  push 4
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push 3
+  push 4
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  push offset .L.data.main.176
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.195
+  mov rax, 0
+  call assert
+  jmp .L.end.main.195
+.L.call.main.195:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.195:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 307 3
+  push 12
+  push 12
+  push offset .L.data.main.177
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.196
+  mov rax, 0
+  call assert
+  jmp .L.end.main.196
+.L.call.main.196:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.196:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 308 3
+  push 5
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.197
+  mov rax, 0
+  call from_header
+  jmp .L.end.main.197
+.L.call.main.197:
+  sub rsp, 8
+  mov rax, 0
+  call from_header
+  add rsp, 8
+.L.end.main.197:
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.178
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.198
+  mov rax, 0
+  call assert
+  jmp .L.end.main.198
+.L.call.main.198:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.198:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 309 3
+  push 6
+  push 6
+  push offset .L.data.main.180
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.199
+  mov rax, 0
+  call assert
+  jmp .L.end.main.199
+.L.call.main.199:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.199:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 310 3
+  push 3
+  lea rax, [rbp-4]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-4]
+  push rax
+  pop rax
+  movsxd rax, DWORD PTR [rax]
+  push rax
+  push offset .L.data.main.181
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.200
+  mov rax, 0
+  call assert
+  jmp .L.end.main.200
+.L.call.main.200:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.200:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 313 3
+  push 1
+  push 1
+  push offset .L.data.main.182
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.201
+  mov rax, 0
+  call assert
+  jmp .L.end.main.201
+.L.call.main.201:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.201:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 320 3
+  push 1
+  push 1
+  push offset .L.data.main.183
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.202
+  mov rax, 0
+  call assert
+  jmp .L.end.main.202
+.L.call.main.202:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.202:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 324 3
+  push 1
+  push 1
+  push offset .L.data.main.184
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.203
+  mov rax, 0
+  call assert
+  jmp .L.end.main.203
+.L.call.main.203:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.L.end.main.203:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 328 3
+  push offset .L.data.main.185
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.204
+  mov rax, 0
+  call puts
+  jmp .L.end.main.204
+.L.call.main.204:
+  sub rsp, 8
+  mov rax, 0
+  call puts
+  add rsp, 8
+.L.end.main.204:
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  .loc 1 329 3
+  push 0
+  pop rax
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  .cfi_def_cfa rsp, 8
+  ret
+  .cfi_endproc
+.size main, .-main
+  .data
+.L.data.main.185:
+  .byte 0x6f
+  .byte 0x6b
+  .byte 0x21
+  .byte 0x0
+.L.data.main.184:
+  .byte 0x23
+  .byte 0x75
+  .byte 0x6e
+  .byte 0x64
+  .byte 0x65
+  .byte 0x66
+  .byte 0x20
+  .byte 0x54
+  .byte 0x45
+  .byte 0x4e
+  .byte 0x0
+.L.data.main.183:
+  .byte 0x23
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x30
+  .byte 0x20
+  .byte 0x7c
+  .byte 0x7c
+  .byte 0x20
+  .byte 0x21
+  .byte 0x55
+  .byte 0x4e
+  .byte 0x44
+  .byte 0x45
+  .byte 0x46
+  .byte 0x49
+  .byte 0x4e
+  .byte 0x45
+  .byte 0x44
+  .byte 0x0
+.L.data.main.182:
+  .byte 0x23
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x64
+  .byte 0x65
+  .byte 0x66
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x65
+  .byte 0x64
+  .byte 0x20
+  .byte 0x28
+  .byte 0x54
+  .byte 0x45
+  .byte 0x4e
+  .byte 0x29
+  .byte 0x20
+  .byte 0x26
+  .byte 0x26
+  .byte 0x20
+  .byte 0x54
+  .byte 0x45
+  .byte 0x4e
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x20
+  .byte 0x32
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x32
+  .byte 0x30
+  .byte 0x0
+.L.data.main.181:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x53
+  .byte 0x45
+  .byte 0x4c
+  .byte 0x46
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x53
+  .byte 0x45
+  .byte 0x4c
+  .byte 0x46
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.180:
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x53
+  .byte 0x54
+  .byte 0x52
+  .byte 0x20
+  .byte 0x28
+  .byte 0x61
+  .byte 0x20
+  .byte 0x2b
+  .byte 0x20
+  .byte 0x62
+  .byte 0x29
+  .byte 0x29
+  .byte 0x0
+.L.data.main.179:
+  .byte 0x61
+  .byte 0x20
+  .byte 0x2b
+  .byte 0x20
+  .byte 0x62
+  .byte 0x0
+.L.data.main.178:
+  .byte 0x43
+  .byte 0x41
+  .byte 0x54
+  .byte 0x20
+  .byte 0x28
+  .byte 0x66
+  .byte 0x72
+  .byte 0x6f
+  .byte 0x6d
+  .byte 0x5f
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x68
+  .byte 0x65
+  .byte 0x61
+  .byte 0x64
+  .byte 0x65
+  .byte 0x72
+  .byte 0x29
+  .byte 0x20
+  .byte 0x28
+  .byte 0x29
+  .byte 0x0
+.L.data.main.177:
+  .byte 0x43
+  .byte 0x41
+  .byte 0x54
+  .byte 0x20
+  .byte 0x28
+  .byte 0x31
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x32
+  .byte 0x29
+  .byte 0x0
+.L.data.main.176:
+  .byte 0x53
+  .byte 0x51
+  .byte 0x55
+  .byte 0x41
+  .byte 0x52
+  .byte 0x45
+  .byte 0x20
+  .byte 0x28
+  .byte 0x41
+  .byte 0x44
+  .byte 0x44
+  .byte 0x20
+  .byte 0x28
+  .byte 0x33
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x34
+  .byte 0x29
+  .byte 0x29
+  .byte 0x0
+.L.data.main.175:
+  .byte 0x41
+  .byte 0x44
+  .byte 0x44
+  .byte 0x20
+  .byte 0x28
+  .byte 0x33
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x34
+  .byte 0x29
+  .byte 0x0
+.L.data.main.174:
+  .byte 0x54
+  .byte 0x45
+  .byte 0x4e
+  .byte 0x0
+.L.data.main.173:
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.172:
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.171:
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.170:
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.169:
+  .byte 0x67
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.168:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7d
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.167:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7d
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.166:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7d
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.165:
+  .byte 0x22
+  .byte 0x6c
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.164:
+  .byte 0x6c
+  .byte 0x0
+.L.data.main.163:
+  .byte 0x22
+  .byte 0x6b
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.162:
+  .byte 0x6b
+  .byte 0x0
+.L.data.main.161:
+  .byte 0x22
+  .byte 0x6a
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.160:
+  .byte 0x6a
+  .byte 0x0
+.L.data.main.159:
+  .byte 0x22
+  .byte 0x30
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.158:
+  .byte 0x0
+  .byte 0x0
+.L.data.main.157:
+  .byte 0x22
+  .byte 0x65
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.156:
+  .byte 0x1b
+  .byte 0x0
+.L.data.main.155:
+  .byte 0x22
+  .byte 0x72
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.154:
+  .byte 0xd
+  .byte 0x0
+.L.data.main.153:
+  .byte 0x22
+  .byte 0x66
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.152:
+  .byte 0xc
+  .byte 0x0
+.L.data.main.151:
+  .byte 0x22
+  .byte 0x6e
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.150:
+  .byte 0xb
+  .byte 0x0
+.L.data.main.149:
+  .byte 0x22
+  .byte 0x6e
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.148:
+  .byte 0xa
+  .byte 0x0
+.L.data.main.147:
+  .byte 0x22
+  .byte 0x74
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.146:
+  .byte 0x9
+  .byte 0x0
+.L.data.main.145:
+  .byte 0x22
+  .byte 0x62
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.144:
+  .byte 0x8
+  .byte 0x0
+.L.data.main.143:
+  .byte 0x22
+  .byte 0x61
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.142:
+  .byte 0x7
+  .byte 0x0
+.L.data.main.141:
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x22
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x22
+  .byte 0x29
+  .byte 0x0
+.L.data.main.140:
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x0
+.L.data.main.139:
+  .byte 0x22
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.138:
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x0
+.L.data.main.137:
+  .byte 0x22
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.136:
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x0
+.L.data.main.135:
+  .byte 0x22
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.134:
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x0
+.L.data.main.133:
+  .byte 0x22
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x22
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.132:
+  .byte 0x61
+  .byte 0x62
+  .byte 0x63
+  .byte 0x0
+.L.data.main.131:
+  .byte 0x6c
+  .byte 0x65
+  .byte 0x61
+  .byte 0x66
+  .byte 0x5f
+  .byte 0x72
+  .byte 0x65
+  .byte 0x74
+  .byte 0x20
+  .byte 0x28
+  .byte 0x30
+  .byte 0x29
+  .byte 0x0
+.L.data.main.130:
+  .byte 0x6c
+  .byte 0x65
+  .byte 0x61
+  .byte 0x66
+  .byte 0x5f
+  .byte 0x72
+  .byte 0x65
+  .byte 0x74
+  .byte 0x20
+  .byte 0x28
+  .byte 0x31
+  .byte 0x29
+  .byte 0x0
+.L.data.main.129:
+  .byte 0x61
+  .byte 0x64
+  .byte 0x64
+  .byte 0x72
+  .byte 0x5f
+  .byte 0x74
+  .byte 0x61
+  .byte 0x6b
+  .byte 0x65
+  .byte 0x6e
+  .byte 0x20
+  .byte 0x28
+  .byte 0x34
+  .byte 0x29
+  .byte 0x0
+.L.data.main.128:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x5f
+  .byte 0x77
+  .byte 0x72
+  .byte 0x61
+  .byte 0x70
+  .byte 0x20
+  .byte 0x28
+  .byte 0x29
+  .byte 0x0
+.L.data.main.127:
+  .byte 0x73
+  .byte 0x75
+  .byte 0x6d
+  .byte 0x5f
+  .byte 0x63
+  .byte 0x61
+  .byte 0x6c
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x20
+  .byte 0x28
+  .byte 0x34
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x31
+  .byte 0x29
+  .byte 0x0
+.L.data.main.126:
+  .byte 0x6c
+  .byte 0x65
+  .byte 0x61
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x33
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x34
+  .byte 0x29
+  .byte 0x0
+.L.data.main.125:
+  .byte 0x73
+  .byte 0x75
+  .byte 0x62
+  .byte 0x5f
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x28
+  .byte 0x37
+  .byte 0x2c
+  .byte 0x33
+  .byte 0x2c
+  .byte 0x33
+  .byte 0x29
+  .byte 0x0
+.L.data.main.124:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.123:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.122:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.121:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.120:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.119:
+  .byte 0x63
+  .byte 0x68
+  .byte 0x61
+  .byte 0x72
+  .byte 0x20
+  .byte 0x63
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x6c
+  .byte 0x6f
+  .byte 0x6e
+  .byte 0x67
+  .byte 0x20
+  .byte 0x6c
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x63
+  .byte 0x2b
+  .byte 0x6c
+  .byte 0x2b
+  .byte 0x69
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.118:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.117:
+  .byte 0x6c
+  .byte 0x6f
+  .byte 0x6e
+  .byte 0x67
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x36
+  .byte 0x35
+  .byte 0x35
+  .byte 0x33
+  .byte 0x36
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x2f
+  .byte 0x36
+  .byte 0x35
+  .byte 0x35
+  .byte 0x33
+  .byte 0x36
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.116:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x36
+  .byte 0x35
+  .byte 0x35
+  .byte 0x33
+  .byte 0x36
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.115:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x6c
+  .byte 0x6f
+  .byte 0x6e
+  .byte 0x67
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x79
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.114:
+  .byte 0x6c
+  .byte 0x6f
+  .byte 0x6e
+  .byte 0x67
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.113:
+  .byte 0x6c
+  .byte 0x6f
+  .byte 0x6e
+  .byte 0x67
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.112:
+  .byte 0x67
+  .byte 0x35
+  .byte 0x0
+.L.data.main.111:
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x67
+  .byte 0x35
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.110:
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x2b
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x2b
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x2b
+  .byte 0x67
+  .byte 0x34
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x0
+.L.data.main.109:
+  .byte 0x67
+  .byte 0x33
+  .byte 0x0
+.L.data.main.108:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x31
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3c
+  .byte 0x20
+  .byte 0x78
+  .byte 0x29
+  .byte 0x20
+  .byte 0x78
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x31
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.107:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x31
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3c
+  .byte 0x20
+  .byte 0x78
+  .byte 0x29
+  .byte 0x20
+  .byte 0x7b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x31
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7d
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.106:
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x61
+  .byte 0x20
+  .byte 0x3c
+  .byte 0x20
+  .byte 0x62
+  .byte 0x29
+  .byte 0x20
+  .byte 0x6d
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x65
+  .byte 0x20
+  .byte 0x6d
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x62
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x28
+  .byte 0x39
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x37
+  .byte 0x29
+  .byte 0x0
+.L.data.main.105:
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x61
+  .byte 0x20
+  .byte 0x3c
+  .byte 0x20
+  .byte 0x62
+  .byte 0x29
+  .byte 0x20
+  .byte 0x6d
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x65
+  .byte 0x20
+  .byte 0x6d
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x62
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.104:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x63
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x63
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x61
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.103:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x63
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x63
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x61
+  .byte 0x20
+  .byte 0x2b
+  .byte 0x20
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.102:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x71
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x63
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x28
+  .byte 0x63
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x71
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x30
+  .byte 0x29
+  .byte 0x20
+  .byte 0x2b
+  .byte 0x20
+  .byte 0x31
+  .byte 0x20
+  .byte 0x2d
+  .byte 0x20
+  .byte 0x71
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.101:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x71
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x63
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x63
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x71
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.100:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2e
+  .byte 0x2e
+  .byte 0x2e
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x70
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x70
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x70
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x61
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.99:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x31
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x36
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.98:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.97:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.96:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x20
+  .byte 0x3d
+  .byte 0x20
+  .byte 0x78
+  .byte 0x20
+  .byte 0x3c
+  .byte 0x20
+  .byte 0x31
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x37
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x38
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.95:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x79
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x33
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x34
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.94:
+  .byte 0x30
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x32
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x33
+  .byte 0x0
+.L.data.main.93:
+  .byte 0x31
+  .byte 0x20
+  .byte 0x3f
+  .byte 0x20
+  .byte 0x32
+  .byte 0x20
+  .byte 0x3a
+  .byte 0x20
+  .byte 0x33
+  .byte 0x0
+.L.data.main.92:
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x67
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.91:
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x67
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.90:
+  .byte 0x67
+  .byte 0x32
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.89:
+  .byte 0x67
+  .byte 0x32
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.88:
+  .byte 0x67
+  .byte 0x32
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.87:
+  .byte 0x67
+  .byte 0x32
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.86:
+  .byte 0x67
+  .byte 0x31
+  .byte 0x0
+.L.data.main.85:
+  .byte 0x67
+  .byte 0x31
+  .byte 0x0
+.L.data.main.84:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.83:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x20
+  .byte 0x2b
+  .byte 0x20
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.82:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x29
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.81:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.80:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.79:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.78:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.77:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.76:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.75:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x73
+  .byte 0x69
+  .byte 0x7a
+  .byte 0x65
+  .byte 0x6f
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x78
+  .byte 0x29
+  .byte 0x0
+.L.data.main.74:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x5b
+  .byte 0x35
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.73:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x5b
+  .byte 0x34
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.72:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.71:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.70:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.69:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x30
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.68:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.67:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.66:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x31
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.65:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x79
+  .byte 0x2b
+  .byte 0x35
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.64:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x79
+  .byte 0x2b
+  .byte 0x34
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.63:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x79
+  .byte 0x2b
+  .byte 0x33
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.62:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x79
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.61:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x79
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.60:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.59:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.58:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.57:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x33
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.56:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x5b
+  .byte 0x32
+  .byte 0x5d
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.55:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x64
+  .byte 0x64
+  .byte 0x78
+  .byte 0x20
+  .byte 0x28
+  .byte 0x26
+  .byte 0x78
+  .byte 0x2c
+  .byte 0x20
+  .byte 0x79
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.54:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x26
+  .byte 0x79
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x37
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.53:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x26
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3d
+  .byte 0x37
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.52:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.51:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x7a
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x79
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x7a
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x29
+  .byte 0x0
+.L.data.main.50:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x7a
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x7a
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x0
+.L.data.main.49:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x28
+  .byte 0x26
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x32
+  .byte 0x29
+  .byte 0x20
+  .byte 0x2d
+  .byte 0x20
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.48:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x26
+  .byte 0x79
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.47:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x31
+  .byte 0x2b
+  .byte 0x26
+  .byte 0x78
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.46:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x26
+  .byte 0x78
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.45:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x79
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x7a
+  .byte 0x3d
+  .byte 0x26
+  .byte 0x79
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x2a
+  .byte 0x7a
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.44:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x2a
+  .byte 0x26
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.43:
+  .byte 0x66
+  .byte 0x69
+  .byte 0x62
+  .byte 0x28
+  .byte 0x39
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.42:
+  .byte 0x61
+  .byte 0x64
+  .byte 0x64
+  .byte 0x36
+  .byte 0x28
+  .byte 0x31
+  .byte 0x2c
+  .byte 0x32
+  .byte 0x2c
+  .byte 0x33
+  .byte 0x2c
+  .byte 0x34
+  .byte 0x2c
+  .byte 0x35
+  .byte 0x2c
+  .byte 0x36
+  .byte 0x29
+  .byte 0x0
+.L.data.main.41:
+  .byte 0x73
+  .byte 0x75
+  .byte 0x62
+  .byte 0x32
+  .byte 0x28
+  .byte 0x35
+  .byte 0x2c
+  .byte 0x33
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.40:
+  .byte 0x61
+  .byte 0x64
+  .byte 0x64
+  .byte 0x32
+  .byte 0x28
+  .byte 0x35
+  .byte 0x2c
+  .byte 0x33
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.39:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x6a
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x66
+  .byte 0x6f
+  .byte 0x72
+  .byte 0x28
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3c
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x2b
+  .byte 0x2b
+  .byte 0x29
+  .byte 0x20
+  .byte 0x6a
+  .byte 0x3d
+  .byte 0x69
+  .byte 0x2b
+  .byte 0x6a
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x6a
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.38:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x6a
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x77
+  .byte 0x68
+  .byte 0x69
+  .byte 0x6c
+  .byte 0x65
+  .byte 0x28
+  .byte 0x69
+  .byte 0x3c
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x30
+  .byte 0x29
+  .byte 0x20
+  .byte 0x7b
+  .byte 0x6a
+  .byte 0x3d
+  .byte 0x69
+  .byte 0x2b
+  .byte 0x6a
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x69
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x7d
+  .byte 0x20
+  .byte 0x6a
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.37:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x77
+  .byte 0x68
+  .byte 0x69
+  .byte 0x6c
+  .byte 0x65
+  .byte 0x20
+  .byte 0x28
+  .byte 0x69
+  .byte 0x3c
+  .byte 0x31
+  .byte 0x30
+  .byte 0x29
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3d
+  .byte 0x69
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.36:
+  .byte 0x31
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7b
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x7d
+  .byte 0x20
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.35:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x32
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x29
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x65
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.34:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x31
+  .byte 0x29
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x65
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.33:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x31
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x29
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x65
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.32:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x66
+  .byte 0x20
+  .byte 0x28
+  .byte 0x30
+  .byte 0x29
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x32
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x65
+  .byte 0x6c
+  .byte 0x73
+  .byte 0x65
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x78
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.31:
+  .byte 0x72
+  .byte 0x65
+  .byte 0x74
+  .byte 0x33
+  .byte 0x28
+  .byte 0x28
+  .byte 0x29
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.30:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x66
+  .byte 0x6f
+  .byte 0x6f
+  .byte 0x31
+  .byte 0x32
+  .byte 0x33
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x62
+  .byte 0x61
+  .byte 0x72
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x66
+  .byte 0x6f
+  .byte 0x6f
+  .byte 0x31
+  .byte 0x32
+  .byte 0x33
+  .byte 0x2b
+  .byte 0x62
+  .byte 0x61
+  .byte 0x72
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.29:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x66
+  .byte 0x6f
+  .byte 0x6f
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x66
+  .byte 0x6f
+  .byte 0x6f
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.28:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x7a
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x2b
+  .byte 0x7a
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.27:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.26:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x7a
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x7a
+  .byte 0x3d
+  .byte 0x35
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x2b
+  .byte 0x7a
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.25:
+  .byte 0x69
+  .byte 0x6e
+  .byte 0x74
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3d
+  .byte 0x33
+  .byte 0x3b
+  .byte 0x20
+  .byte 0x61
+  .byte 0x3b
+  .byte 0x0
+.L.data.main.24:
+  .byte 0x32
+  .byte 0x3e
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.23:
+  .byte 0x31
+  .byte 0x3e
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.22:
+  .byte 0x31
+  .byte 0x3e
+  .byte 0x3d
+  .byte 0x30
+  .byte 0x0
+.L.data.main.21:
+  .byte 0x31
+  .byte 0x3e
+  .byte 0x32
+  .byte 0x0
+.L.data.main.20:
+  .byte 0x31
+  .byte 0x3e
+  .byte 0x31
+  .byte 0x0
+.L.data.main.19:
+  .byte 0x31
+  .byte 0x3e
+  .byte 0x30
+  .byte 0x0
+.L.data.main.18:
+  .byte 0x32
+  .byte 0x3c
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.17:
+  .byte 0x31
+  .byte 0x3c
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.16:
+  .byte 0x30
+  .byte 0x3c
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.15:
+  .byte 0x32
+  .byte 0x3c
+  .byte 0x31
+  .byte 0x0
+.L.data.main.14:
+  .byte 0x31
+  .byte 0x3c
+  .byte 0x31
+  .byte 0x0
+.L.data.main.13:
+  .byte 0x30
+  .byte 0x3c
+  .byte 0x31
+  .byte 0x0
+.L.data.main.12:
+  .byte 0x34
+  .byte 0x32
+  .byte 0x21
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x32
+  .byte 0x0
+.L.data.main.11:
+  .byte 0x30
+  .byte 0x21
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.10:
+  .byte 0x34
+  .byte 0x32
+  .byte 0x3d
+  .byte 0x3d
+  .byte 0x34
+  .byte 0x32
+  .byte 0x0
+.L.data.main.9:
+  .byte 0x30
+  .byte 0x3d
+  .byte 0x3d
+  .byte 0x31
+  .byte 0x0
+.L.data.main.8:
+  .byte 0x2d
+  .byte 0x2d
+  .byte 0x2b
+  .byte 0x31
+  .byte 0x30
+  .byte 0x0
+.L.data.main.7:
+  .byte 0x2d
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x30
+  .byte 0x0
+.L.data.main.6:
+  .byte 0x2d
+  .byte 0x31
+  .byte 0x30
+  .byte 0x0
+.L.data.main.5:
+  .byte 0x28
+  .byte 0x33
+  .byte 0x2b
+  .byte 0x35
+  .byte 0x29
+  .byte 0x2f
+  .byte 0x32
+  .byte 0x0
+.L.data.main.4:
+  .byte 0x35
+  .byte 0x2a
+  .byte 0x28
+  .byte 0x39
+  .byte 0x2d
+  .byte 0x36
+  .byte 0x29
+  .byte 0x0
+.L.data.main.3:
+  .byte 0x31
+  .byte 0x32
+  .byte 0x20
+  .byte 0x2b
+  .byte 0x20
+  .byte 0x33
+  .byte 0x34
+  .byte 0x20
+  .byte 0x2d
+  .byte 0x20
+  .byte 0x35
+  .byte 0x0
+.L.data.main.2:
+  .byte 0x35
+  .byte 0x0
+.L.data.main.1:
+  .byte 0x34
+  .byte 0x32
+  .byte 0x0
+.L.data.main.0:
+  .byte 0x30
+  .byte 0x0
+  .text
+  .data
+  .align 8
+g5:
+  .quad 7
+  .align 4
+g4:
+  .long 0
+  .long 1
+  .long 2
+  .long 3
+  .align 4
+g3:
+  .long 3
+  .align 4
+g2:
+  .zero 16
+  .align 4
+g1:
+  .zero 4
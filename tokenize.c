@@ -4,9 +4,9 @@ char *TokenKindStr [] = {
   "RESERVED", "IDENT", "STR", "NUM", "EOF",
 };
 
-Token *token;
-char *filename;
-char *user_input;
+_Thread_local Token *token;
+_Thread_local char *filename;
+_Thread_local char *user_input;
 
 // Reports an error and exit.
 void error (char *fmt, ...) {
@@ -17,22 +17,53 @@ void error (char *fmt, ...) {
   exit (1);
 }
 
-// Reports ana error location and exit.
-static void verror_at (char *loc, char *fmt, va_list ap) {
-  char *line = loc;
-  while (user_input < line && line [-1] != '\n')
-    line--;
+// The file being lexed
+static _Thread_local File *cur_file;
+
+// Creates a source file. The offsets of the first byte of every line
+// are recorded once, so that locations are found by binary search
+// instead of rescanning the input for every diagnostic.
+File *new_file (char *name, char *contents) {
+  File *file = calloc (1, sizeof (File));
+  file->name = name;
+  file->contents = contents;
+
+  int cap = 64;
+  file->line_starts = malloc (cap * sizeof (int));
+  file->line_starts [file->nlines++] = 0;
+
+  for (char *p = contents; (p = strchr (p, '\n')); p++) {
+    if (file->nlines == cap) {
+      cap *= 2;
+      file->line_starts = realloc (file->line_starts, cap * sizeof (int));
+    }
+    file->line_starts [file->nlines++] = p + 1 - contents;
+  }
+  return file;
+}
+
+// Returns the 0-based index of the line containing loc.
+static int find_line (File *file, char *loc) {
+  int off = loc - file->contents;
+  int lo = 0, hi = file->nlines - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (file->line_starts [mid] <= off)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
 
+// Reports ana error location and exit.
+static void verror_at (char *filename, char *loc, int line_no, int col, char *fmt, va_list ap) {
+  char *line = loc - (col - 1);
   char *end = loc;
-  while (*end != '\n')
+  while (*end && *end != '\n')
     end++;
 
-  int line_num = 1;
-  for (char *p = user_input; p < line; p++)
-    if (*p == '\n')
-      line_num++;
-
-  int indent = fprintf (stderr, "%s:%d: ", filename, line_num);
+  int indent = fprintf (stderr, "%s:%d: ", filename, line_no);
   fprintf (stderr, "%.*s\n", (int) (end - line), line);
 
   int pos = loc - line + indent;
@@ -50,14 +81,16 @@ static void verror_at (char *loc, char *fmt, va_list ap) {
 void error_at (char *loc, char *fmt, ...) {
   va_list ap;
   va_start (ap, fmt);
-  verror_at (loc, fmt, ap);
+  int i = find_line (cur_file, loc);
+  verror_at (cur_file->name, loc, i + 1, loc - cur_file->contents - cur_file->line_starts [i] + 1,
+             fmt, ap);
 }
 
 // Reports an error location and exit.
 void error_tok (Token *tok, char *fmt, ...) {
   va_list ap;
   va_start (ap, fmt);
-  verror_at (tok->str, fmt, ap);
+  verror_at (tok->file->name, tok->str, tok->line_no, tok->col, fmt, ap);
 }
 
 // Check whether the currect token matches a given string.
@@ -76,7 +109,7 @@ Token *consume (char *op) {
       strncmp (token->str, op, token->len))
     return NULL;
   Token *tok = token;
-  token = token->next;
+  token++;
   return tok;
 }
 
@@ -85,7 +118,7 @@ Token *consume_ident (void) {
   if (token->kind != TK_IDENT)
     return NULL;
   Token *tok_ident = token;
-  token = token->next;
+  token++;
   return tok_ident;
 }
 
@@ -93,7 +126,7 @@ Token *consume_ident (void) {
 void expect (char *s) {
   if (!peek (s))
     error_tok (token, "expected \"%s\"", s);
-  token = token->next;
+  token++;
 }
 
 // return num from sequence
@@ -101,7 +134,7 @@ int expect_number (void) {
   if (token->kind != TK_NUM)
     error_tok (token, "expected a number");
   int val = token->val;
-  token = token->next;
+  token++;
   return val;
 }
 
@@ -111,7 +144,7 @@ char *expect_ident (void) {
   if (token->kind != TK_IDENT)
     error_tok (token, "expected an identifier");
   char *ident_name = strndup (token->str, token->len);
-  token = token->next;
+  token++;
   return ident_name;
 }
 
@@ -119,13 +152,50 @@ bool at_eof () {
   return token->kind == TK_EOF;
 }
 
-// create new Token and append it to cur
-static Token *new_token (TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc (1, sizeof (Token));
+// Lexer state. Line of the most recently created token: tokens are
+// created in source order, so the cursor only ever moves forward.
+static _Thread_local char *lex_pos;
+static _Thread_local int cur_line;
+static _Thread_local bool at_bol;	// No token yet on the current line
+static _Thread_local short cur_file_no;
+
+// String literal contents live as long as their tokens.
+static _Thread_local Arena token_arena;
+static _Thread_local Arena *lex_arena;
+
+// Preprocessed tokens of the current input
+static _Thread_local Token *tokens;
+static _Thread_local int ntokens;
+static _Thread_local int tokens_cap;
+
+// Appends an uninitialized token to the token array. The array
+// may move, so the pointer is only valid until the next call.
+static Token *push_token (void) {
+  if (ntokens == tokens_cap) {
+    tokens_cap *= 2;
+    tokens = realloc (tokens, tokens_cap * sizeof (Token));
+  }
+  return &tokens [ntokens++];
+}
+
+// Initializes tok as a token at str in the current file.
+static Token *new_token (Token *tok, TokenKind kind, char *str, int len) {
+  stats.tokens++;
+  *tok = (Token) {};
   tok->kind = kind;
   tok->str  = str;
   tok->len  = len;
-  cur->next = tok;
+  tok->file = cur_file;
+  tok->file_no = cur_file_no;
+  tok->at_bol = at_bol;
+  at_bol = false;
+
+  int off = str - cur_file->contents;
+  int *line_starts = cur_file->line_starts;
+  while (cur_line + 1 < cur_file->nlines && line_starts [cur_line + 1] <= off)
+    cur_line++;
+  tok->line_no = cur_line + 1;
+  tok->col     = off - line_starts [cur_line] + 1;
   return tok;
 }
 
@@ -144,7 +214,7 @@ static bool is_alnum (char c) {
 static char *starts_with_reserved (char *p) {
   // Keyword
   static char *kw [] = { "return", "if", "else", "while", "for", "sizeof",
-                         "int", "char"
+                         "int", "char", "long"
                        };
 
   for (int i = 0; i < sizeof (kw) / sizeof (*kw); i++) {
@@ -154,7 +224,8 @@ static char *starts_with_reserved (char *p) {
   }
 
   // Multi-letter punctuator
-  static char *ops [] = { "==", "!=", "<=", ">=" };
+  static char *ops [] = { "==", "!=", "<=", ">=", "&&", "||", "<<", ">>",
+                          "##" };
 
   for (int i = 0; i < sizeof (ops) / sizeof (*ops); i++)
     if (startswith (p, ops [i]))
@@ -178,7 +249,7 @@ static char get_escape_char (char c) {
   }
 }
 
-static Token *read_string_literal (Token *cur, char *start) {
+static void read_string_literal (Token *tok, char *start) {
   char *p = start + 1;
   char buf [1024];
   int len = 0;
@@ -199,26 +270,32 @@ static Token *read_string_literal (Token *cur, char *start) {
     }
   }
 
-  Token *tok = new_token (TK_STR, cur, start, p - start + 1);
-  //Token *tok = new_token (TK_STR, cur, start, len + 2);
-  tok->contents = malloc (len + 1);
+  new_token (tok, TK_STR, start, p - start + 1);
+  tok->contents = arena_alloc (lex_arena, len + 1);
   memcpy (tok->contents, buf, len);
   tok->contents [len] = '\0';
   tok->cont_len = len + 1;
-  return tok;
 }
 
-// Tokenize string
-Token *tokenize (void) {
-  char *p = user_input;
-  Token head = {};
-  Token *cur = &head;
-
+// Reads the next token at lex_pos into tok. At the end of
+// input, tok becomes a TK_EOF token.
+static void lex (Token *tok) {
+  char *p = lex_pos;
   char *kw;
-  while (*p) {
-    if (isspace (*p)) {
+
+  for (;;) {
+    if (!*p) {
+      new_token (tok, TK_EOF, p, 0);
+      break;
+    } else if (*p == '\n') {
+      at_bol = true;
+      p++;
+    } else if (isspace (*p)) {
       // skip white space
       p++;
+    } else if (startswith (p, "\\\n")) {
+      // line continuation
+      p += 2;
     } else if (startswith (p, "//")) {
       // skip line comment
       p += 2;
@@ -233,47 +310,169 @@ Token *tokenize (void) {
     } else if ((kw = starts_with_reserved (p)) != NULL) {
       // Keywords or multi-letter punctuators
       int len = strlen (kw);
-      cur = new_token (TK_RESERVED, cur, p, len);
+      new_token (tok, TK_RESERVED, p, len);
       p += len;
+      break;
     } else if (*p == '"') {
       // String literals
-      cur = read_string_literal (cur, p);
-      p += cur->len;
+      read_string_literal (tok, p);
+      p += tok->len;
+      break;
     } else if (ispunct (*p)) {
       // Single-letter punctuators
-      cur = new_token (TK_RESERVED, cur, p++, 1);
+      new_token (tok, TK_RESERVED, p++, 1);
+      break;
     } else if (is_alpha (*p)) {
       // identifier
       char *q = p++;
       while (is_alnum (*p))
         p++;
-      cur = new_token (TK_IDENT, cur, q, p - q);
+      new_token (tok, TK_IDENT, q, p - q);
+      break;
     } else if (isdigit (*p)) {
       // Integer literal
-      cur = new_token (TK_NUM, cur, p, 0);
+      new_token (tok, TK_NUM, p, 0);
       char *q = p;
-      cur->val = strtol (p, &p, 10);
-      cur->len = p - q;
+      tok->val = strtol (p, &p, 10);
+      tok->len = p - q;
+      break;
     } else {
       error_at (p, "invalid token\n");
     }
   }
 
-  // EOF
-  new_token (TK_EOF, cur, p, 0);
-  return head.next;
+  lex_pos = p;
 }
 
+static void lex_begin (File *file, short file_no, Arena *strings) {
+  cur_file = file;
+  cur_file_no = file_no;
+  cur_line = 0;
+  lex_pos = file->contents;
+  at_bol = true;
+  lex_arena = strings;
+}
+
+// Lexes the next token of the main input. The preprocessor
+// reads the main input through this, one token at a time.
+void lex_next (Token *tok) {
+  lex (tok);
+}
+
+// Lexes all of file into a new array terminated by TK_EOF. String
+// literal contents are allocated in strings. The state of the main
+// input is kept, so this may be called in the middle of it.
+Token *tokenize_file (File *file, Arena *strings) {
+  File *file0 = cur_file;
+  short file_no0 = cur_file_no;
+  char *pos0 = lex_pos;
+  int line0 = cur_line;
+  bool bol0 = at_bol;
+  Arena *arena0 = lex_arena;
+
+  lex_begin (file, 0, strings);
+  int len = 0, cap = 256;
+  Token *toks = malloc (cap * sizeof (Token));
+  do {
+    if (len == cap) {
+      cap *= 2;
+      toks = realloc (toks, cap * sizeof (Token));
+    }
+    lex (&toks [len]);
+  } while (toks [len++].kind != TK_EOF);
+
+  cur_file = file0;
+  cur_file_no = file_no0;
+  lex_pos = pos0;
+  cur_line = line0;
+  at_bol = bol0;
+  lex_arena = arena0;
+  return toks;
+}
+
+// Prepares to tokenize user_input.
+void tokenize_begin (void) {
+  // The array of the previous input stays alive; its
+  // nodes and diagnostics still point into it.
+  ntokens = 0;
+  tokens_cap = 1024;
+  tokens = malloc (tokens_cap * sizeof (Token));
+  token_arena = (Arena) {};
+
+  File *file = new_file (filename, user_input);
+  short file_no = opt_precompile ? PCH_FILE_NO : 1;
+  lex_begin (file, file_no, &token_arena);
+  preprocess_begin (file, file_no);
+}
+
+// Tokenize string
+Token *tokenize (void) {
+  tokenize_begin ();
+  for (;;) {
+    Token *tok = push_token ();
+    preprocess_next (tok);
+    if (tok->kind == TK_EOF)
+      return tokens;
+  }
+}
+
+static bool is_punct (Token *tok, char c) {
+  return tok->kind == TK_RESERVED && tok->len == 1 && tok->str [0] == c;
+}
+
+// Tokenizes the next top-level item only: a function definition or a
+// global variable declaration, followed by a TK_EOF token. The tokens
+// of the previous item are discarded. At the end of input, the array
+// holds just TK_EOF.
+Token *tokenize_item (void) {
+  ntokens = 0;
+  arena_free (&token_arena);
+
+  int depth = 0;
+  bool is_body = false;
+  for (;;) {
+    Token *tok = push_token ();
+    preprocess_next (tok);
+    if (tok->kind == TK_EOF)
+      return tokens;
+
+    if (is_punct (tok, '{')) {
+      // A brace right after ")" at the top level opens a function body.
+      if (depth++ == 0)
+        is_body = ntokens > 1 && is_punct (tok - 1, ')');
+    } else if (is_punct (tok, '}')) {
+      if (--depth == 0 && is_body)
+        break;
+    } else if (is_punct (tok, ';') && depth == 0) {
+      break;
+    }
+  }
+
+  // The end of an item is not the end of a line.
+  bool bol = at_bol;
+  new_token (push_token (), TK_EOF, lex_pos, 0);
+  at_bol = bol;
+  return tokens;
+}
+
+// Hands the tokens of the current item and their string contents
+// over to the caller, who frees them once nothing refers to them.
+// The next item is lexed into a fresh array.
+void tokenize_release (Token **toks, Arena *strings) {
+  *toks = tokens;
+  *strings = token_arena;
+  tokens = malloc (tokens_cap * sizeof (Token));
+  token_arena = (Arena) {};
+}
 
 void print_tokens (Token *head) {
   if (head == NULL)
     return;
 
   printf ("%s", TokenKindStr [head->kind]);
-  Token *cur = head->next;
-  while (cur != NULL) {
+  for (Token *cur = head; cur->kind != TK_EOF; ) {
+    cur++;
     printf (" -> %s", TokenKindStr [cur->kind]);
-    cur = cur->next;
   }
   printf ("\n");
 }
@@ -1,60 +1,118 @@
 #include "dcc.h"
 
 Type *char_type = &(Type) { TY_CHAR, 1 };
-Type *int_type  = &(Type) { TY_INT, 8 };
+Type *int_type  = &(Type) { TY_INT, 4 };
+Type *long_type = &(Type) { TY_LONG, 8 };
 
 bool is_integer (Type *ty) {
-  return ty->kind == TY_CHAR || ty->kind == TY_INT;
+  return ty->kind == TY_CHAR || ty->kind == TY_INT || ty->kind == TY_LONG;
 }
 
-Type *pointer_to (Type *base) {
-  Type *ty = calloc (1, sizeof (Type));
-  ty->kind = TY_PTR;
-  ty->size = 8;
-  ty->base = base;
-  return ty;
+// Scalars are aligned to their size, arrays like their elements.
+int type_align (Type *ty) {
+  while (ty->kind == TY_ARRAY)
+    ty = ty->base;
+  return ty->size;
 }
 
-Type *array_of (Type *base, int len) {
+// Arithmetic is done in 64-bit registers; the result is long if
+// either operand is.
+static Type *arith_type (Type *lhs, Type *rhs) {
+  return lhs == long_type || rhs == long_type ? long_type : int_type;
+}
+
+static Type *new_type (TypeKind kind, int size, Type *base) {
   Type *ty = calloc (1, sizeof (Type));
-  ty->kind = TY_ARRAY;
-  ty->size = base->size * len;
+  ty->kind = kind;
+  ty->size = size;
   ty->base = base;
-  ty->array_len = len;
   return ty;
 }
 
-void add_type (Node *node) {
-  if (!node || node->ty)
-    return;
+// Another thread may intern the same type concurrently. Whoever
+// publishes first wins and the loser frees its copy.
+Type *pointer_to (Type *base) {
+  Type *ty = atomic_load_explicit (&base->pointer, memory_order_acquire);
+  if (ty)
+    return ty;
+
+  Type *new = new_type (TY_PTR, 8, base);
+  if (!atomic_compare_exchange_strong (&base->pointer, &ty, new)) {
+    free (new);
+    return ty;
+  }
+  stats.types++;
+  return new;
+}
+
+static Type *find_array (Type *list, int len) {
+  for (Type *ty = list; ty; ty = ty->next)
+    if (ty->array_len == len)
+      return ty;
+  return NULL;
+}
 
-  add_type (node->lhs);
-  add_type (node->rhs);
-  add_type (node->cond);
-  add_type (node->then);
-  add_type (node->els);
-  add_type (node->init);
-  add_type (node->inc);
+Type *array_of (Type *base, int len) {
+  Type *head = atomic_load_explicit (&base->arrays, memory_order_acquire);
+  Type *ty = find_array (head, len);
+  if (ty)
+    return ty;
 
-  for (Node *n = node->body; n; n = n->next)
-   add_type (n);
-  for (Node *n = node->args; n; n = n->next)
-   add_type (n);
+  Type *new = new_type (TY_ARRAY, base->size * len, base);
+  new->array_len = len;
+  for (;;) {
+    new->next = head;
+    if (atomic_compare_exchange_strong (&base->arrays, &head, new)) {
+      stats.types++;
+      return new;
+    }
 
+    // Lost the race; head is now the updated list.
+    if ((ty = find_array (head, len))) {
+      free (new);
+      return ty;
+    }
+  }
+}
+
+// Assigns the type of a node whose operands are already typed.
+// The parser calls this as it builds each node, so every
+// expression is typed exactly once, bottom-up.
+void set_type (Node *node) {
   switch (node->kind) {
   case ND_ADD:
   case ND_SUB:
-  case ND_PTR_DIFF:
   case ND_MUL:
   case ND_DIV:
+    node->ty = arith_type (node->lhs->ty, node->rhs->ty);
+    return;
+  case ND_PTR_DIFF:
+    node->ty = long_type;
+    return;
   case ND_EQ:
   case ND_NE:
   case ND_LT:
   case ND_LE:
-  case ND_FUNCALL:
   case ND_NUM:
     node->ty = int_type;
     return;
+  case ND_FUNCALL:
+    // The parser sets the return type of the functions it knows.
+    if (!node->ty)
+      node->ty = int_type;
+    return;
+  case ND_COND: {
+    // If either arm is a pointer (or an array, which decays to one),
+    // so is the result, as in "p ? 0 : q".
+    Type *then = node->then->ty, *els = node->els->ty;
+    if (is_integer (then) && is_integer (els)) {
+      node->ty = arith_type (then, els);
+      return;
+    }
+    Type *ty = is_integer (then) ? els : then;
+    node->ty = ty->kind == TY_ARRAY ? pointer_to (ty->base) : ty;
+    return;
+  }
   case ND_PTR_ADD:
   case ND_PTR_SUB:
   case ND_ASSIGN:
@@ -84,3 +142,53 @@ void add_type (Node *node) {
   }
 }
 
+static bool is_stmt (Node *node) {
+  switch (node->kind) {
+  case ND_NULL:
+  case ND_RETURN:
+  case ND_IF:
+  case ND_WHILE:
+  case ND_FOR:
+  case ND_BLOCK:
+  case ND_EXPR_STMT:
+    return true;
+  }
+  return false;
+}
+
+// Checks that every expression under node has been typed.
+// Runs once over each function body after it is parsed.
+void check_types (Node *node) {
+  if (!node)
+    return;
+  if (!is_stmt (node) && !node->ty)
+    error_tok (node->tok, "internal error: untyped expression");
+
+  switch (node->kind) {
+  case ND_NULL:
+  case ND_NUM:
+  case ND_VAR:
+    return;
+  case ND_IF:
+  case ND_COND:
+  case ND_WHILE:
+  case ND_FOR:
+    check_types (node->cond);
+    check_types (node->then);
+    check_types (node->els);	// or init
+    check_types (node->inc);
+    return;
+  case ND_BLOCK:
+  case ND_STMT_EXPR:
+    for (Node *n = node->body; n; n = n->next)
+      check_types (n);
+    return;
+  case ND_FUNCALL:
+    for (Node *n = node->args; n; n = n->next)
+      check_types (n);
+    return;
+  default:
+    check_types (node->lhs);
+    check_types (node->rhs);
+  }
+}